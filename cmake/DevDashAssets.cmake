@@ -0,0 +1,91 @@
+# DevDashAssets.cmake - Build-time baking of Qt Quick 3D assets
+#
+# Runs balsam over source assets (HDR light probes, OBJ meshes) at build time
+# and embeds the baked results as Qt resources:
+# - HDR images become prefiltered, mip-chained KTX light probes, so Quick 3D
+#   does not have to load and filter the full HDR at runtime
+# - OBJ meshes are re-indexed and reordered for vertex cache locality
+#
+# Each bake is keyed on a SHA-256 of its input, the balsam binary and the bake
+# options (see bake-asset.cmake). Touching an input without changing it, or
+# re-running CMake, does not trigger a re-bake or a resource recompile.
+
+set(DEVDASH_BAKE_SCRIPT "${CMAKE_CURRENT_LIST_DIR}/bake-asset.cmake")
+
+# Options passed to balsam for every mesh
+set(DEVDASH_MESH_BAKE_OPTIONS
+    --joinIdenticalVertices
+    --improveCacheLocality
+    --optimizeMeshes
+    --removeRedundantMaterials
+)
+
+# devdash_bake_assets(<target> <resource_name>
+#     PREFIX <resource prefix>
+#     [LIGHTPROBES <hdr>...]
+#     [MESHES <obj>...]
+# )
+#
+# Input paths are relative to the current source directory. Baked files keep
+# the same relative layout under PREFIX:
+#   assets/studio.hdr -> <PREFIX>/assets/studio.ktx
+#   assets/dome.obj   -> <PREFIX>/assets/meshes/dome_mesh.mesh
+function(devdash_bake_assets target resource_name)
+    cmake_parse_arguments(arg "" "PREFIX" "LIGHTPROBES;MESHES" ${ARGN})
+
+    set(bake_dir "${CMAKE_CURRENT_BINARY_DIR}/baked")
+    set(stamp_dir "${bake_dir}/.stamps")
+    set(stamps "")
+    set(baked_files "")
+
+    string(REPLACE ";" "|" mesh_options "${DEVDASH_MESH_BAKE_OPTIONS}")
+
+    foreach(kind IN ITEMS LIGHTPROBES MESHES)
+        foreach(input IN LISTS arg_${kind})
+            get_filename_component(input_abs "${input}" ABSOLUTE)
+            get_filename_component(input_dir "${input}" DIRECTORY)
+            get_filename_component(input_name "${input}" NAME_WE)
+
+            if(kind STREQUAL "LIGHTPROBES")
+                set(product "${input_name}.ktx")
+                set(options "")
+            else()
+                string(TOLOWER "${input_name}" mesh_name)
+                set(product "meshes/${mesh_name}_mesh.mesh")
+                set(options "${mesh_options}")
+            endif()
+
+            set(output_dir "${bake_dir}/${input_dir}")
+            set(stamp "${stamp_dir}/${input_dir}/${input_name}.sha256")
+
+            add_custom_command(
+                OUTPUT "${stamp}"
+                BYPRODUCTS "${output_dir}/${product}"
+                COMMAND ${CMAKE_COMMAND}
+                    "-DBALSAM=$<TARGET_FILE:Qt6::balsam>"
+                    "-DINPUT=${input_abs}"
+                    "-DOUTPUT_DIR=${output_dir}"
+                    "-DPRODUCTS=${product}"
+                    "-DOPTIONS=${options}"
+                    "-DSTAMP=${stamp}"
+                    -P "${DEVDASH_BAKE_SCRIPT}"
+                DEPENDS "${input_abs}" "${DEVDASH_BAKE_SCRIPT}" Qt6::balsam
+                COMMENT "Baking ${input}"
+                VERBATIM
+            )
+
+            set_source_files_properties("${output_dir}/${product}" PROPERTIES GENERATED TRUE)
+            list(APPEND stamps "${stamp}")
+            list(APPEND baked_files "${output_dir}/${product}")
+        endforeach()
+    endforeach()
+
+    add_custom_target(${target}_baked_assets DEPENDS ${stamps})
+    add_dependencies(${target} ${target}_baked_assets)
+
+    qt_add_resources(${target} "${resource_name}"
+        PREFIX "${arg_PREFIX}"
+        BASE "${bake_dir}"
+        FILES ${baked_files}
+    )
+endfunction()
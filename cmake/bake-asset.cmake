@@ -0,0 +1,69 @@
+# bake-asset.cmake - Bake one asset with balsam, skipping unchanged inputs
+#
+# Invoked via `cmake -P` from devdash_bake_assets(). Expects:
+#   BALSAM      Path to the balsam executable
+#   INPUT       Source asset (.hdr, .obj)
+#   OUTPUT_DIR  Directory receiving the baked products
+#   PRODUCTS    |-separated product paths, relative to the balsam output dir
+#   OPTIONS     |-separated extra balsam options
+#   STAMP       Stamp file recording the bake key of the last successful bake
+#
+# The bake key is a SHA-256 over the input content, the balsam binary and the
+# options. If the key matches the stamp, only the stamp is refreshed. Products
+# are copied with ONLY_IF_DIFFERENT so an identical re-bake does not dirty the
+# resource compiler either.
+
+string(REPLACE "|" ";" products "${PRODUCTS}")
+string(REPLACE "|" ";" options "${OPTIONS}")
+get_filename_component(input_name "${INPUT}" NAME)
+
+file(SHA256 "${INPUT}" input_hash)
+file(SHA256 "${BALSAM}" tool_hash)
+string(SHA256 bake_key "${input_hash}|${tool_hash}|${OPTIONS}")
+
+set(up_to_date FALSE)
+if(EXISTS "${STAMP}")
+    file(READ "${STAMP}" previous_key)
+    string(STRIP "${previous_key}" previous_key)
+    if(previous_key STREQUAL bake_key)
+        set(up_to_date TRUE)
+        foreach(product IN LISTS products)
+            if(NOT EXISTS "${OUTPUT_DIR}/${product}")
+                set(up_to_date FALSE)
+            endif()
+        endforeach()
+    endif()
+endif()
+
+if(up_to_date)
+    file(TOUCH "${STAMP}")
+    return()
+endif()
+
+set(work_dir "${STAMP}.work")
+file(REMOVE_RECURSE "${work_dir}")
+file(MAKE_DIRECTORY "${work_dir}")
+
+execute_process(
+    COMMAND "${BALSAM}" ${options} --outputPath "${work_dir}" "${INPUT}"
+    RESULT_VARIABLE result
+    OUTPUT_VARIABLE output
+    ERROR_VARIABLE output
+)
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "balsam failed on ${input_name} (exit ${result}):\n${output}")
+endif()
+
+foreach(product IN LISTS products)
+    if(NOT EXISTS "${work_dir}/${product}")
+        message(FATAL_ERROR "balsam did not produce ${product} from ${input_name}:\n${output}")
+    endif()
+    get_filename_component(product_dir "${OUTPUT_DIR}/${product}" DIRECTORY)
+    file(MAKE_DIRECTORY "${product_dir}")
+    file(COPY_FILE "${work_dir}/${product}" "${OUTPUT_DIR}/${product}" ONLY_IF_DIFFERENT)
+endforeach()
+
+file(REMOVE_RECURSE "${work_dir}")
+file(WRITE "${STAMP}" "${bake_key}\n")
+message(STATUS "Baked ${input_name} [${bake_key}]")
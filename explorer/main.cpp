@@ -1,11 +1,17 @@
+#include <QCommandLineParser>
 #include <QGuiApplication>
 #include <QQmlApplicationEngine>
 #include <QQmlContext>
 #include <QQuickStyle>
+#include <QQuickWindow>
+#include "pipelinecache.h"
 #include "stateserver.h"
 
 int main(int argc, char *argv[])
 {
+    // Started first so the first-frame report covers the whole startup
+    FirstFrameReporter firstFrame;
+
     // Qt 6.10+ uses CurveRenderer for Shape antialiasing - no MSAA needed
     QGuiApplication app(argc, argv);
 
@@ -15,9 +21,56 @@ int main(int argc, char *argv[])
     app.setApplicationName("QML Gauges Explorer");
     app.setApplicationVersion("1.0.0");
 
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Component explorer for the DevDash Gauges library");
+    parser.addHelpOption();
+    parser.addVersionOption();
+    QCommandLineOption cacheOption("pipeline-cache",
+        "Keep compiled graphics pipelines across runs.");
+    QCommandLineOption cacheDirOption("pipeline-cache-dir",
+        "Pipeline cache directory (implies --pipeline-cache).", "dir");
+    QCommandLineOption warmUpOption("warm-up",
+        "Render every page offscreen to fill the pipeline cache, then exit.");
+    QCommandLineOption firstFrameOption("first-frame",
+        "Exit once the first frame is presented (for startup timing).");
+    parser.addOptions({cacheOption, cacheDirOption, warmUpOption, firstFrameOption});
+    parser.process(app);
+    firstFrame.setQuitAfterFirstFrame(parser.isSet(firstFrameOption));
+
     // Use Fusion style for better cross-platform appearance
     QQuickStyle::setStyle("Fusion");
 
+    // Add QML import paths for the gauge library
+    // In production, modules would be installed to system QML path
+    const QStringList importPaths = {
+        "qrc:/",
+        ":/",
+        QCoreApplication::applicationDirPath() + "/../qml",
+        QCoreApplication::applicationDirPath() + "/qml",
+    };
+
+    // Persistent pipeline cache (opt-in); the directory may also come from
+    // the environment
+    QString cacheDir = parser.value(cacheDirOption);
+    if (cacheDir.isEmpty())
+        cacheDir = qEnvironmentVariable("QML_GAUGES_PIPELINE_CACHE_DIR");
+    if (cacheDir.isEmpty() && (parser.isSet(cacheOption) || parser.isSet(warmUpOption)))
+        cacheDir = PipelineCache::defaultDirectory();
+
+    PipelineCache pipelineCache(cacheDir);
+    if (!pipelineCache.load() && pipelineCache.isEnabled()) {
+        qInfo().noquote() << "Pipeline cache is cold:" << pipelineCache.reason();
+    }
+
+    if (parser.isSet(warmUpOption)) {
+        PipelineWarmUp warmUp(&pipelineCache, importPaths);
+        const int rendered = warmUp.run(PipelineWarmUp::explorerPages());
+        qInfo().noquote() << QString("Warm-up rendered %1 pages (%2 pipeline cache)")
+                                 .arg(rendered).arg(pipelineCache.stateName());
+        pipelineCache.store();
+        return rendered > 0 ? 0 : 1;
+    }
+
     // Create and start the WebSocket state server for MCP integration
     StateServer stateServer;
     int statePort = 9876;
@@ -35,40 +88,63 @@ int main(int argc, char *argv[])
         qWarning() << "Failed to start state server - MCP integration disabled";
     }
 
-    // Create QML engine
-    QQmlApplicationEngine engine;
+    // The engine is scoped so its window, and with it the QRhi that saves
+    // the pipeline data, is gone before the cache file is written
+    int result = 0;
+    {
+        // Create QML engine
+        QQmlApplicationEngine engine;
 
-    // Expose state server to QML
-    engine.rootContext()->setContextProperty("stateServer", &stateServer);
+        // Expose state server to QML
+        engine.rootContext()->setContextProperty("stateServer", &stateServer);
 
-    // Add QML import paths for the gauge library
-    engine.addImportPath("qrc:/");
-    engine.addImportPath(":/");
+        for (const QString &path : importPaths)
+            engine.addImportPath(path);
 
-    // Add build directory import path for development
-    // In production, modules would be installed to system QML path
-    engine.addImportPath(QCoreApplication::applicationDirPath() + "/../qml");
-    engine.addImportPath(QCoreApplication::applicationDirPath() + "/qml");
-
-    // Load main QML file
-    const QUrl url(QStringLiteral("qrc:/Explorer/qml/Main.qml"));
-
-    QObject::connect(
-        &engine,
-        &QQmlApplicationEngine::objectCreated,
-        &app,
-        [url](QObject *obj, const QUrl &objUrl) {
-            if (!obj && url == objUrl) {
-                QCoreApplication::exit(-1);
-            }
-        },
-        Qt::QueuedConnection);
-
-    engine.load(url);
-
-    if (engine.rootObjects().isEmpty()) {
-        return -1;
+        // Load main QML file
+        const QUrl url(QStringLiteral("qrc:/Explorer/qml/Main.qml"));
+
+        // Direct connection: the graphics configuration must be set before the
+        // window is exposed and its scene graph initialized
+        QObject::connect(
+            &engine,
+            &QQmlApplicationEngine::objectCreated,
+            &app,
+            [&](QObject *obj, const QUrl &objUrl) {
+                auto *window = qobject_cast<QQuickWindow *>(obj);
+                if (!window || url != objUrl) {
+                    return;
+                }
+                pipelineCache.attach(window);
+                // Read at the first frame: setDriver() may turn a warm
+                // cache stale once the scene graph is initialized
+                firstFrame.watch(window, [&pipelineCache]() {
+                    return pipelineCache.isEnabled()
+                        ? pipelineCache.stateName() + " pipeline cache"
+                        : QString("pipeline cache disabled");
+                });
+            });
+
+        QObject::connect(
+            &engine,
+            &QQmlApplicationEngine::objectCreated,
+            &app,
+            [url](QObject *obj, const QUrl &objUrl) {
+                if (!obj && url == objUrl) {
+                    QCoreApplication::exit(-1);
+                }
+            },
+            Qt::QueuedConnection);
+
+        engine.load(url);
+
+        if (engine.rootObjects().isEmpty()) {
+            return -1;
+        }
+
+        result = app.exec();
     }
 
-    return app.exec();
+    pipelineCache.store();
+    return result;
 }
@@ -0,0 +1,338 @@
+#include "pipelinecache.h"
+
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QQmlComponent>
+#include <QQmlEngine>
+#include <QQuickItem>
+#include <QQuickRenderControl>
+#include <QQuickRenderTarget>
+#include <QQuickWindow>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <rhi/qrhi.h>
+
+#include <memory>
+
+namespace {
+
+constexpr quint32 kMagic = 0x44445043;  // "DDPC"
+constexpr quint32 kFormatVersion = 1;
+constexpr QDataStream::Version kStreamVersion = QDataStream::Qt_6_5;
+
+constexpr char kCacheFileName[] = "gauges-pipelines.cache";
+constexpr char kLoadFileName[] = "qt-pipelines.load";
+constexpr char kSaveFileName[] = "qt-pipelines.save";
+
+// Warm-up renders at the explorer's default window size
+constexpr QSize kWarmUpSize(1280, 800);
+
+// Enough frames for Loaders, deferred effects and View3D to build pipelines
+constexpr int kWarmUpFramesPerPage = 4;
+
+QByteArray payloadChecksum(const QByteArray &payload)
+{
+    return QCryptographicHash::hash(payload, QCryptographicHash::Sha256);
+}
+
+} // namespace
+
+// === PipelineCache ===
+
+PipelineCache::PipelineCache(const QString &directory)
+    : m_directory(directory)
+{
+}
+
+QString PipelineCache::defaultDirectory()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/pipelines");
+}
+
+QString PipelineCache::filePath() const
+{
+    return QDir(m_directory).filePath(QLatin1String(kCacheFileName));
+}
+
+QString PipelineCache::loadFilePath() const
+{
+    return QDir(m_directory).filePath(QLatin1String(kLoadFileName));
+}
+
+QString PipelineCache::saveFilePath() const
+{
+    return QDir(m_directory).filePath(QLatin1String(kSaveFileName));
+}
+
+QString PipelineCache::stateName() const
+{
+    switch (m_state) {
+    case Disabled: return QStringLiteral("disabled");
+    case Cold: return QStringLiteral("cold");
+    case Warm: return QStringLiteral("warm");
+    case Stale: return QStringLiteral("stale");
+    }
+    return QString();
+}
+
+bool PipelineCache::load()
+{
+    if (!isEnabled()) {
+        m_state = Disabled;
+        return false;
+    }
+
+    m_state = Cold;
+    if (!QDir().mkpath(m_directory)) {
+        m_reason = QStringLiteral("cannot create %1").arg(m_directory);
+        return false;
+    }
+
+    // Leftovers from a run that did not exit cleanly are never trusted
+    QFile::remove(loadFilePath());
+    QFile::remove(saveFilePath());
+
+    QFile file(filePath());
+    if (!file.open(QIODevice::ReadOnly)) {
+        m_reason = QStringLiteral("no cache file");
+        return false;
+    }
+
+    QDataStream in(&file);
+    in.setVersion(kStreamVersion);
+    quint32 magic = 0;
+    quint32 version = 0;
+    QByteArray qtVersion;
+    QByteArray driver;
+    QByteArray checksum;
+    QByteArray payload;
+    in >> magic >> version;
+    if (in.status() != QDataStream::Ok || magic != kMagic) {
+        m_reason = QStringLiteral("not a pipeline cache file");
+        return false;
+    }
+    if (version != kFormatVersion) {
+        m_reason = QStringLiteral("cache format %1, expected %2").arg(version).arg(kFormatVersion);
+        return false;
+    }
+
+    in >> qtVersion >> driver >> checksum >> payload;
+    if (in.status() != QDataStream::Ok) {
+        m_reason = QStringLiteral("truncated cache file");
+        return false;
+    }
+    if (qtVersion != qVersion()) {
+        m_reason = QStringLiteral("written by Qt %1").arg(QString::fromLatin1(qtVersion));
+        return false;
+    }
+    if (payload.isEmpty() || checksum != payloadChecksum(payload)) {
+        m_reason = QStringLiteral("checksum mismatch");
+        return false;
+    }
+
+    // Qt reads raw pipeline data from a file of its own
+    QFile raw(loadFilePath());
+    if (!raw.open(QIODevice::WriteOnly) || raw.write(payload) != payload.size()) {
+        m_reason = QStringLiteral("cannot write %1").arg(raw.fileName());
+        return false;
+    }
+
+    m_storedDriver = driver;
+    m_state = Warm;
+    m_reason.clear();
+    return true;
+}
+
+QQuickGraphicsConfiguration PipelineCache::configuration() const
+{
+    QQuickGraphicsConfiguration config;
+    if (!isEnabled())
+        return config;
+
+    // Explicit files replace Qt's own unversioned per-application cache
+    config.setAutomaticPipelineCache(false);
+    if (m_state == Warm || m_state == Stale)
+        config.setPipelineCacheLoadFile(loadFilePath());
+    config.setPipelineCacheSaveFile(saveFilePath());
+    return config;
+}
+
+void PipelineCache::attach(QQuickWindow *window)
+{
+    if (!isEnabled())
+        return;
+
+    window->setGraphicsConfiguration(configuration());
+
+    // Emitted on the render thread; the driver is read back on the GUI thread
+    QObject::connect(window, &QQuickWindow::sceneGraphInitialized, window, [this, window]() {
+        if (window->rhi())
+            setDriver(window->rhi());
+    }, Qt::SingleShotConnection);
+}
+
+void PipelineCache::setDriver(QRhi *rhi)
+{
+    const QRhiDriverInfo info = rhi->driverInfo();
+    m_driver = QByteArray(rhi->backendName()) + ' ' + info.deviceName + ' '
+        + QByteArray::number(info.vendorId, 16) + ':' + QByteArray::number(info.deviceId, 16);
+
+    if (m_state == Warm && !m_storedDriver.isEmpty() && m_storedDriver != m_driver) {
+        // Qt ignores pipeline data from another device or driver; say why
+        // startup is cold and let store() replace the file
+        m_state = Stale;
+        m_reason = QStringLiteral("driver changed from %1").arg(QString::fromUtf8(m_storedDriver));
+        qInfo().noquote() << "Pipeline cache is stale:" << m_reason;
+    }
+}
+
+bool PipelineCache::store()
+{
+    if (!isEnabled())
+        return false;
+
+    QFile raw(saveFilePath());
+    const QByteArray payload = raw.open(QIODevice::ReadOnly) ? raw.readAll() : QByteArray();
+    raw.close();
+    QFile::remove(saveFilePath());
+    QFile::remove(loadFilePath());
+
+    // Nothing was rendered, or Qt could not save: keep the previous file
+    if (payload.isEmpty() || m_driver.isEmpty())
+        return false;
+
+    QSaveFile file(filePath());
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Pipeline cache: cannot write" << file.fileName() << ":" << file.errorString();
+        return false;
+    }
+
+    QDataStream out(&file);
+    out.setVersion(kStreamVersion);
+    out << kMagic << kFormatVersion << QByteArray(qVersion()) << m_driver
+        << payloadChecksum(payload) << payload;
+    if (out.status() != QDataStream::Ok || !file.commit()) {
+        qWarning() << "Pipeline cache: cannot write" << file.fileName() << ":" << file.errorString();
+        return false;
+    }
+
+    qInfo().noquote() << "Pipeline cache saved:" << filePath() << QStringLiteral("(%1 KiB)").arg(payload.size() / 1024);
+    return true;
+}
+
+// === FirstFrameReporter ===
+
+FirstFrameReporter::FirstFrameReporter()
+{
+    m_timer.start();
+}
+
+void FirstFrameReporter::watch(QQuickWindow *window, const std::function<QString()> &label)
+{
+    // Measured on the render thread, as soon as the frame is presented
+    QObject::connect(window, &QQuickWindow::frameSwapped, window, [this, window, label]() {
+        const qint64 elapsed = m_timer.elapsed();
+        QString device = QStringLiteral("software");
+        if (QRhi *rhi = window->rhi()) {
+            device = QString::fromLatin1(rhi->backendName());
+            const QByteArray name = rhi->driverInfo().deviceName;
+            if (!name.isEmpty())
+                device += QStringLiteral(" on ") + QString::fromUtf8(name);
+        }
+        qInfo().noquote() << QStringLiteral("First frame after %1 ms (%2, %3)").arg(elapsed).arg(label(), device);
+        if (m_quit)
+            QMetaObject::invokeMethod(qApp, &QCoreApplication::quit, Qt::QueuedConnection);
+    }, Qt::ConnectionType(Qt::DirectConnection | Qt::SingleShotConnection));
+}
+
+// === PipelineWarmUp ===
+
+PipelineWarmUp::PipelineWarmUp(PipelineCache *cache, const QStringList &importPaths)
+    : m_cache(cache)
+    , m_importPaths(importPaths)
+{
+}
+
+QStringList PipelineWarmUp::explorerPages()
+{
+    QStringList pages;
+    const QDir dir(QStringLiteral(":/Explorer/qml/pages"));
+    const QStringList files = dir.entryList({QStringLiteral("*Page.qml")}, QDir::Files, QDir::Name);
+    for (const QString &file : files)
+        pages.append(QStringLiteral("qrc:/Explorer/qml/pages/") + file);
+    return pages;
+}
+
+int PipelineWarmUp::run(const QStringList &pages)
+{
+    QQmlEngine engine;
+    for (const QString &path : std::as_const(m_importPaths))
+        engine.addImportPath(path);
+
+    // The window must go before the render control, and the render target
+    // resources before both; the QRhi saves the pipeline data when released
+    QQuickRenderControl control;
+    QQuickWindow window(&control);
+    window.resize(kWarmUpSize);
+    m_cache->attach(&window);
+
+    if (!control.initialize()) {
+        qWarning() << "Warm-up: cannot initialize offscreen rendering";
+        return 0;
+    }
+
+    QRhi *rhi = control.rhi();
+    std::unique_ptr<QRhiTexture> texture(rhi->newTexture(QRhiTexture::RGBA8, kWarmUpSize, 1,
+                                                         QRhiTexture::RenderTarget));
+    std::unique_ptr<QRhiRenderBuffer> depthStencil(rhi->newRenderBuffer(QRhiRenderBuffer::DepthStencil,
+                                                                        kWarmUpSize, 1));
+    if (!texture->create() || !depthStencil->create()) {
+        qWarning() << "Warm-up: cannot create render target";
+        return 0;
+    }
+
+    QRhiTextureRenderTargetDescription description(QRhiColorAttachment(texture.get()));
+    description.setDepthStencilBuffer(depthStencil.get());
+    std::unique_ptr<QRhiTextureRenderTarget> target(rhi->newTextureRenderTarget(description));
+    std::unique_ptr<QRhiRenderPassDescriptor> renderPass(target->newCompatibleRenderPassDescriptor());
+    target->setRenderPassDescriptor(renderPass.get());
+    if (!target->create()) {
+        qWarning() << "Warm-up: cannot create render target";
+        return 0;
+    }
+    window.setRenderTarget(QQuickRenderTarget::fromRhiRenderTarget(target.get()));
+
+    int rendered = 0;
+    for (const QString &page : pages) {
+        QElapsedTimer timer;
+        timer.start();
+
+        QQmlComponent component(&engine, QUrl(page));
+        std::unique_ptr<QObject> object(component.create());
+        auto *item = qobject_cast<QQuickItem *>(object.get());
+        if (!item) {
+            qWarning().noquote() << "Warm-up: cannot create" << page << component.errorString();
+            continue;
+        }
+        item->setParentItem(window.contentItem());
+        item->setSize(window.size());
+
+        for (int frame = 0; frame < kWarmUpFramesPerPage; ++frame) {
+            QCoreApplication::processEvents();
+            control.polishItems();
+            control.beginFrame();
+            control.sync();
+            control.render();
+            control.endFrame();
+        }
+
+        qInfo().noquote() << QStringLiteral("Warm-up: %1 in %2 ms").arg(QUrl(page).fileName()).arg(timer.elapsed());
+        ++rendered;
+    }
+
+    return rendered;
+}
@@ -0,0 +1,169 @@
+#ifndef PIPELINECACHE_H
+#define PIPELINECACHE_H
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QQuickGraphicsConfiguration>
+#include <QString>
+#include <QStringList>
+
+#include <functional>
+
+class QQuickWindow;
+class QRhi;
+
+/**
+ * @brief Persistent graphics pipeline cache for the explorer.
+ *
+ * Keeps the shader pipelines built by MultiEffect, CurveRenderer Shapes and
+ * the Quick3D materials across runs, so a warm start skips recompiling them.
+ *
+ * Qt reads and writes the raw pipeline data through QQuickGraphicsConfiguration.
+ * This class wraps that data in a cache file in directory():
+ *
+ *   magic, format version, Qt version, driver key, SHA-256 of the payload,
+ *   payload
+ *
+ * load() unpacks the payload only if the format version and Qt version match
+ * and the checksum verifies. The driver key (backend, device and vendor) is
+ * only known once a window has a QRhi; setDriver() compares it with the stored
+ * one and, on a mismatch, reports the cache stale. Qt rejects pipeline data
+ * from a different device or driver itself, and the next store() replaces it.
+ *
+ * @example
+ * @code
+ * PipelineCache cache(dir);
+ * cache.load();
+ * window->setGraphicsConfiguration(cache.configuration());
+ * // ... run ...
+ * cache.store();
+ * @endcode
+ */
+class PipelineCache
+{
+public:
+    enum State {
+        Disabled,  // no cache directory
+        Cold,      // no usable cache file; pipelines are compiled and saved
+        Warm,      // cache file loaded
+        Stale      // loaded, but written by another driver
+    };
+
+    explicit PipelineCache(const QString &directory = QString());
+
+    /**
+     * @brief Default directory: the application cache location.
+     */
+    static QString defaultDirectory();
+
+    QString directory() const { return m_directory; }
+    QString filePath() const;
+    bool isEnabled() const { return !m_directory.isEmpty(); }
+
+    State state() const { return m_state; }
+    QString stateName() const;
+
+    /**
+     * @brief Why the cache file was not loaded; empty when warm.
+     */
+    QString reason() const { return m_reason; }
+
+    /**
+     * @brief Validates the cache file and unpacks its payload for Qt.
+     * @return true when a usable cache was found
+     */
+    bool load();
+
+    /**
+     * @brief Graphics configuration loading and saving the raw pipeline data.
+     *
+     * Must be applied before the window's scene graph is initialized.
+     */
+    QQuickGraphicsConfiguration configuration() const;
+
+    /**
+     * @brief Applies configuration() to window and records its driver once
+     * the scene graph is initialized.
+     */
+    void attach(QQuickWindow *window);
+
+    /**
+     * @brief Records the driver the pipelines are built for.
+     */
+    void setDriver(QRhi *rhi);
+
+    /**
+     * @brief Wraps the pipeline data Qt saved into the cache file.
+     *
+     * Call after every window using configuration() is destroyed; Qt writes
+     * its data when the QRhi is released.
+     */
+    bool store();
+
+private:
+    QString loadFilePath() const;
+    QString saveFilePath() const;
+
+    QString m_directory;
+    State m_state = Disabled;
+    QString m_reason;
+    QByteArray m_storedDriver;
+    QByteArray m_driver;
+};
+
+/**
+ * @brief Reports the time from process start to a window's first frame.
+ */
+class FirstFrameReporter
+{
+public:
+    FirstFrameReporter();
+
+    /**
+     * @brief Prints the latency of window's first frame, tagged with label
+     * and the graphics backend and device that presented it.
+     *
+     * label is called when the frame is presented, after the scene graph
+     * is initialized, so it can describe state settled during that step.
+     */
+    void watch(QQuickWindow *window, const std::function<QString()> &label);
+
+    /**
+     * @brief Quits the application once the first frame is reported.
+     * @default false
+     */
+    void setQuitAfterFirstFrame(bool quit) { m_quit = quit; }
+
+private:
+    QElapsedTimer m_timer;
+    bool m_quit = false;
+};
+
+/**
+ * @brief Renders every explorer page offscreen once to fill a pipeline cache.
+ *
+ * Uses QQuickRenderControl with a texture render target, so no window is
+ * shown. Each page is instantiated, rendered for a few frames so delayed
+ * items and effects get their pipelines too, and destroyed.
+ */
+class PipelineWarmUp
+{
+public:
+    PipelineWarmUp(PipelineCache *cache, const QStringList &importPaths);
+
+    /**
+     * @brief Renders pages (qrc URLs); returns the number rendered.
+     */
+    int run(const QStringList &pages);
+
+    /**
+     * @brief All pages under the explorer's qrc pages directory.
+     */
+    static QStringList explorerPages();
+
+private:
+    PipelineCache *m_cache;
+    QStringList m_importPaths;
+};
+
+#endif // PIPELINECACHE_H
@@ -167,6 +167,13 @@ ListView {
             pagePath: "pages/RadialGauge3DPage.qml"
             isHeader: false
         }
+        ListElement {
+            category: "Templates"
+            title: "BarGauge"
+            description: "Linear / LED-segment bar gauge"
+            pagePath: "pages/BarGaugePage.qml"
+            isHeader: false
+        }
     }
 
     delegate: Item {
@@ -3,6 +3,7 @@ pragma ComponentBehavior: Bound
 import QtQuick
 import QtQuick.Controls
 import QtQuick.Layouts
+import DevDash.Gauges
 import Explorer
 import "../editors"
 
@@ -12,6 +13,10 @@ ScrollView {
     property var target          // The component instance to modify
     property var properties: []  // Property metadata array
     property var stateServer: null  // Optional state server for MCP integration
+    property string componentName: ""  // Component type, used to look up presets
+
+    // Compiled presets available for this component (see presets/)
+    readonly property var presetIds: componentName !== "" ? GaugePresets.presets(componentName) : []
 
     // Map of property name -> editor item for bidirectional updates
     property var editorMap: ({})
@@ -64,6 +69,39 @@ ScrollView {
             color: Theme.divider
         }
 
+        // Preset selector (applies all preset values as one batch)
+        RowLayout {
+            Layout.fillWidth: true
+            visible: root.presetIds.length > 0
+            spacing: 10
+
+            Label {
+                text: "preset"
+                Layout.preferredWidth: 120
+                color: Theme.textPrimary
+            }
+
+            ComboBox {
+                id: presetCombo
+                Layout.fillWidth: true
+                model: ["(custom)"].concat(root.presetIds)
+
+                onActivated: (index) => {
+                    if (index > 0) {
+                        root.applyPreset(root.presetIds[index - 1])
+                    }
+                }
+            }
+
+            Label {
+                id: presetTiming
+                Layout.preferredWidth: 60
+                horizontalAlignment: Text.AlignRight
+                font.family: "monospace"
+                color: Theme.textValue
+            }
+        }
+
         // Property editors
         Repeater {
             id: editorRepeater
@@ -154,6 +192,20 @@ ScrollView {
         }
     }
 
+    // Apply a compiled preset to the target, then sync editors to the result
+    function applyPreset(presetId) {
+        if (!root.target || !GaugePresets.apply(root.target, presetId, root.componentName)) {
+            return
+        }
+        presetTiming.text = GaugePresets.lastApplyTime.toFixed(2) + " ms"
+
+        for (const name in root.editorMap) {
+            if (root.target[name] !== undefined) {
+                root.editorMap[name].value = root.target[name]
+            }
+        }
+    }
+
     // Clear editor map when properties change
     onPropertiesChanged: {
         root.editorMap = {}
@@ -0,0 +1,106 @@
+import QtQuick
+import QtQuick.Controls
+import QtQuick.Layouts
+import DevDash.Gauges 1.0
+import "../components"
+
+Item {
+    id: root
+
+    // Component metadata
+    property string title: "BarGauge"
+    property string description: "Linear or LED-segment bar gauge (shift lights, bar graphs). All segments render as one geometry node; value changes only rewrite segments that toggle."
+
+    // State server for MCP integration (passed to PropertyPanel)
+    property var stateServer: null
+
+    // Expose property panel for external access
+    property alias propertyPanel: propertyPanel
+
+    // Property definitions for the editor (with descriptions for documentation panel)
+    property var properties: [
+        // Value
+        {name: "value", type: "real", min: 0, max: 10000, default: 0, category: "Value",
+         description: "Current value. Segments light from minValue up to this value."},
+        {name: "minValue", type: "real", min: 0, max: 1000, default: 0, category: "Value",
+         description: "Minimum value of the bar range."},
+        {name: "maxValue", type: "real", min: 100, max: 10000, default: 100, category: "Value",
+         description: "Maximum value of the bar range. All segments lit at maxValue."},
+
+        // Thresholds
+        {name: "warningThreshold", type: "real", min: 0, max: 10000, default: 100, category: "Thresholds",
+         description: "Segments starting at or above this value use warningColor."},
+        {name: "redlineStart", type: "real", min: 0, max: 10000, default: 100, category: "Thresholds",
+         description: "Segments starting at or above this value use criticalColor."},
+
+        // Layout
+        {name: "segmentCount", type: "int", min: 1, max: 120, default: 40, category: "Layout",
+         description: "Number of LED segments. Use 1 with continuous for a plain linear bar."},
+        {name: "segmentSpacing", type: "real", min: 0, max: 10, default: 2, category: "Layout",
+         description: "Gap between segments in pixels."},
+        {name: "vertical", type: "bool", default: false, category: "Layout",
+         description: "Fill bottom-to-top instead of left-to-right."},
+        {name: "continuous", type: "bool", default: false, category: "Layout",
+         description: "Partially light the boundary segment instead of whole segments only."},
+
+        // Peak
+        {name: "peakHold", type: "bool", default: false, category: "Peak",
+         description: "Show a peak marker segment at the highest recent value."},
+        {name: "peakHoldTime", type: "int", min: 0, max: 5000, default: 1500, category: "Peak",
+         description: "Time in ms the peak is held before dropping to the current value. 0 holds until reset."},
+
+        // Colors
+        {name: "normalColor", type: "color", default: "#00aaff", category: "Colors",
+         description: "Segment color below warningThreshold. Follows the theme until set."},
+        {name: "warningColor", type: "color", default: "#ffaa00", category: "Colors",
+         description: "Segment color from warningThreshold to redlineStart."},
+        {name: "criticalColor", type: "color", default: "#ff4444", category: "Colors",
+         description: "Segment color from redlineStart up."},
+        {name: "peakColor", type: "color", default: "#ffffff", category: "Colors",
+         description: "Color of the peak marker segment."},
+        {name: "unlitOpacity", type: "real", min: 0, max: 1, default: 0.15, category: "Colors",
+         description: "Opacity of unlit segments, which show their dimmed zone color."}
+    ]
+
+    RowLayout {
+        anchors.fill: parent
+        anchors.margins: 20
+        spacing: 20
+
+        // Preview area (60% width)
+        PreviewArea {
+            id: previewArea
+            Layout.fillHeight: true
+            Layout.fillWidth: true
+            Layout.preferredWidth: parent.width * 0.6
+            properties: root.properties
+
+            BarGauge {
+                id: barGauge
+                anchors.centerIn: parent
+                width: barGauge.vertical ? 40 : 480
+                height: barGauge.vertical ? 400 : 40
+                minValue: 0
+                maxValue: 8000
+                warningThreshold: 6000
+                redlineStart: 7000
+                segmentCount: 60
+
+                // Animate value based on preview animation value
+                value: previewArea.animationValue * 80  // 0-8000 range
+            }
+        }
+
+        // Property panel (40% width)
+        PropertyPanel {
+            id: propertyPanel
+            Layout.fillHeight: true
+            Layout.preferredWidth: parent.width * 0.4
+            Layout.minimumWidth: 300
+
+            target: barGauge
+            properties: root.properties
+            stateServer: root.stateServer
+        }
+    }
+}
@@ -231,6 +231,7 @@ Item {
             target: gaugeNeedle
             properties: root.properties
             stateServer: root.stateServer
+            componentName: root.title
         }
     }
 }
@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+"""
+Compile gauge presets into a binary (CBOR) resource.
+
+Reads every presets/<Component>/<preset>.json file, validates it against the
+component's QML property declarations and writes a single CBOR document that
+GaugePresets loads at runtime.
+
+Validation checks:
+1. The component exists (src/**/<Component>.qml)
+2. Every preset property is declared, writable (not readonly) on the component
+3. Every value matches the declared type (real, int, bool, string, color)
+4. String values are in the "Supported:" list of the property doc comment, if any
+
+Output layout (CBOR):
+    { "<Component>": { "<presetId>": {
+        "name": str, "description": str, "source": str,
+        "properties": [[name, type, value], ...] } } }
+
+Usage:
+    python scripts/compile-presets.py <presets_dir> <src_dir> <output.cbor>
+"""
+
+from __future__ import annotations
+
+import json
+import re
+import struct
+import sys
+from pathlib import Path
+
+
+# Base Item properties a preset may also set
+ITEM_PROPERTIES = {
+    'opacity': 'real',
+    'visible': 'bool',
+    'rotation': 'real',
+    'scale': 'real',
+    'z': 'real',
+}
+
+PROPERTY_PATTERN = re.compile(
+    r'^\s*(readonly\s+)?property\s+(\w+)\s+(\w+)\s*(?::|$)')
+SUPPORTED_PATTERN = re.compile(r'Supported:\s*(.+)')
+COLOR_PATTERN = re.compile(r'^(#([0-9a-fA-F]{3}|[0-9a-fA-F]{6}|[0-9a-fA-F]{8})|[a-z]+)$')
+
+
+def parse_component(qml_file: Path) -> dict[str, tuple[str, list[str] | None]]:
+    """Return {property: (type, supported_values)} for writable root properties."""
+    properties = {name: (type_, None) for name, type_ in ITEM_PROPERTIES.items()}
+
+    supported = None
+    depth = 0
+    for line in qml_file.read_text().split('\n'):
+        stripped = line.strip()
+
+        # Collect "Supported:" lists from the doc comment preceding a property
+        match = SUPPORTED_PATTERN.search(stripped)
+        if match and stripped.startswith('*'):
+            supported = re.findall(r'"([^"]+)"', match.group(1))
+
+        # Only properties of the root object (depth 1) are preset targets
+        match = PROPERTY_PATTERN.match(line)
+        if match and depth == 1:
+            readonly, type_, name = match.groups()
+            if not readonly and not name.startswith('_'):
+                properties[name] = (type_, supported or None)
+            supported = None
+
+        if not stripped.startswith(('//', '*', '/*')):
+            depth += line.count('{') - line.count('}')
+
+    return properties
+
+
+def validate_value(type_: str, value) -> bool:
+    if type_ == 'real':
+        return isinstance(value, (int, float)) and not isinstance(value, bool)
+    if type_ == 'int':
+        return isinstance(value, int) and not isinstance(value, bool)
+    if type_ == 'bool':
+        return isinstance(value, bool)
+    if type_ == 'string':
+        return isinstance(value, str)
+    if type_ == 'color':
+        return isinstance(value, str) and COLOR_PATTERN.match(value) is not None
+    return type_ == 'var'
+
+
+# === Minimal CBOR encoder (RFC 8949) ===
+
+def _cbor_head(major: int, length: int) -> bytes:
+    if length < 24:
+        return bytes([(major << 5) | length])
+    if length < 0x100:
+        return bytes([(major << 5) | 24, length])
+    if length < 0x10000:
+        return bytes([(major << 5) | 25]) + struct.pack('>H', length)
+    if length < 0x100000000:
+        return bytes([(major << 5) | 26]) + struct.pack('>I', length)
+    return bytes([(major << 5) | 27]) + struct.pack('>Q', length)
+
+
+def cbor_encode(value) -> bytes:
+    if value is False:
+        return b'\xf4'
+    if value is True:
+        return b'\xf5'
+    if value is None:
+        return b'\xf6'
+    if isinstance(value, int):
+        return _cbor_head(0, value) if value >= 0 else _cbor_head(1, -1 - value)
+    if isinstance(value, float):
+        return b'\xfb' + struct.pack('>d', value)
+    if isinstance(value, str):
+        data = value.encode('utf-8')
+        return _cbor_head(3, len(data)) + data
+    if isinstance(value, (list, tuple)):
+        return _cbor_head(4, len(value)) + b''.join(cbor_encode(v) for v in value)
+    if isinstance(value, dict):
+        return _cbor_head(5, len(value)) + b''.join(
+            cbor_encode(k) + cbor_encode(v) for k, v in value.items())
+    raise TypeError(f"Cannot encode {type(value).__name__} as CBOR")
+
+
+def compile_presets(presets_dir: Path, src_dir: Path) -> tuple[dict, list[str]]:
+    compiled = {}
+    errors = []
+
+    for component_dir in sorted(p for p in presets_dir.iterdir() if p.is_dir()):
+        component = component_dir.name
+        preset_files = sorted(component_dir.glob('*.json'))
+        if not preset_files:
+            continue
+
+        qml_files = list(src_dir.rglob(f'{component}.qml'))
+        if not qml_files:
+            errors.append(f"{component_dir}: no component {component}.qml under {src_dir}")
+            continue
+        declared = parse_component(qml_files[0])
+
+        for preset_file in preset_files:
+            try:
+                preset = json.loads(preset_file.read_text())
+            except json.JSONDecodeError as e:
+                errors.append(f"{preset_file}: invalid JSON: {e}")
+                continue
+
+            for field in ('name', 'description', 'properties'):
+                if field not in preset:
+                    errors.append(f"{preset_file}: missing required field '{field}'")
+            if not isinstance(preset.get('properties'), dict):
+                continue
+
+            properties = []
+            for name, value in preset['properties'].items():
+                if name not in declared:
+                    errors.append(f"{preset_file}: {component} has no writable property '{name}'")
+                    continue
+                type_, supported = declared[name]
+                if not validate_value(type_, value):
+                    errors.append(f"{preset_file}: '{name}' expects {type_}, got {json.dumps(value)}")
+                    continue
+                if supported and value not in supported:
+                    errors.append(f"{preset_file}: '{name}' must be one of {supported}, got \"{value}\"")
+                    continue
+                if type_ == 'real':
+                    value = float(value)
+                properties.append([name, type_, value])
+
+            compiled.setdefault(component, {})[preset_file.stem] = {
+                'name': preset.get('name', preset_file.stem),
+                'description': preset.get('description', ''),
+                'source': preset.get('source', ''),
+                'properties': properties,
+            }
+
+    return compiled, errors
+
+
+def main():
+    if len(sys.argv) != 4:
+        print(__doc__, file=sys.stderr)
+        sys.exit(2)
+
+    presets_dir, src_dir, output = (Path(arg) for arg in sys.argv[1:])
+    compiled, errors = compile_presets(presets_dir, src_dir)
+
+    if errors:
+        for error in errors:
+            print(f"ERROR: {error}", file=sys.stderr)
+        print(f"Preset compilation failed with {len(errors)} error(s)", file=sys.stderr)
+        sys.exit(1)
+
+    output.parent.mkdir(parents=True, exist_ok=True)
+    output.write_bytes(cbor_encode(compiled))
+
+    count = sum(len(p) for p in compiled.values())
+    print(f"Compiled {count} preset(s) for {len(compiled)} component(s) -> {output}")
+
+
+if __name__ == "__main__":
+    main()
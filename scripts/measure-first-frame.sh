@@ -0,0 +1,55 @@
+#!/bin/bash
+#
+# Measure cold vs warm first-frame latency of the Explorer
+#
+# Usage:
+#   ./scripts/measure-first-frame.sh          # 5 runs each
+#   ./scripts/measure-first-frame.sh 10       # 10 runs each
+#
+# Each cold run starts from an empty pipeline cache directory; warm runs
+# reuse the cache the previous run wrote. Prints every run and the median.
+#
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+PROJECT_DIR="$(dirname "$SCRIPT_DIR")"
+BUILD_DIR="$PROJECT_DIR/build"
+EXPLORER_BIN="$BUILD_DIR/explorer/qml-gauges-explorer"
+RUNS="${1:-5}"
+
+if [[ ! -f "$EXPLORER_BIN" ]]; then
+    echo "Error: Explorer not built. Run: cmake --build build"
+    echo "Expected binary at: $EXPLORER_BIN"
+    exit 1
+fi
+
+CACHE_DIR="$(mktemp -d)"
+trap 'rm -rf "$CACHE_DIR"' EXIT
+
+# Prints the "First frame after N ms (...)" line of one run
+first_frame() {
+    "$EXPLORER_BIN" --pipeline-cache-dir "$CACHE_DIR" --first-frame 2>&1 \
+        | grep -m1 "First frame after"
+}
+
+median() {
+    sort -n | awk '{ v[NR] = $1 } END { print (NR % 2) ? v[(NR + 1) / 2] : (v[NR / 2] + v[NR / 2 + 1]) / 2 }'
+}
+
+declare -a cold warm
+for ((i = 0; i < RUNS; i++)); do
+    rm -rf "${CACHE_DIR:?}"/*
+    line="$(first_frame)"
+    echo "cold: $line"
+    cold+=("$(sed -E 's/.*after ([0-9]+) ms.*/\1/' <<< "$line")")
+
+    line="$(first_frame)"
+    echo "warm: $line"
+    warm+=("$(sed -E 's/.*after ([0-9]+) ms.*/\1/' <<< "$line")")
+done
+
+echo
+echo "Median over $RUNS runs:"
+echo "  cold: $(printf '%s\n' "${cold[@]}" | median) ms"
+echo "  warm: $(printf '%s\n' "${warm[@]}" | median) ms"
@@ -0,0 +1,383 @@
+#include "gaugealert.h"
+
+#include <QAbstractAnimation>
+#include <QJSEngine>
+#include <QtMath>
+
+#include <limits>
+
+namespace {
+
+constexpr int kMinimumPeriod = 20;  // ms
+
+} // namespace
+
+// === GaugeAlert ===
+
+GaugeAlert::GaugeAlert(QObject *parent)
+    : QObject(parent)
+    , m_warningThreshold(std::numeric_limits<qreal>::infinity())
+    , m_criticalThreshold(std::numeric_limits<qreal>::infinity())
+{
+    m_dwellTimer.setSingleShot(true);
+    connect(&m_dwellTimer, &QTimer::timeout, this, [this]() {
+        if (targetLevel() == m_pendingLevel)
+            setLevel(m_pendingLevel);
+        else
+            evaluate();
+    });
+}
+
+GaugeAlert::~GaugeAlert()
+{
+    GaugeAlerts *alerts = GaugeAlerts::instance();
+    alerts->setAlerting(this, false);
+    alerts->setFlashing(this, false, m_flashStyle);
+}
+
+void GaugeAlert::componentComplete()
+{
+    // The initial level is adopted without dwell and without levelEntered,
+    // so bindings set in any order cannot report a transient level
+    m_complete = true;
+    m_level = targetLevel();
+    m_pendingLevel = m_level;
+    GaugeAlerts::instance()->setAlerting(this, isAlerting());
+    if (m_level != Normal)
+        emit levelChanged();
+    updateFlashing();
+}
+
+// === Properties ===
+
+void GaugeAlert::setEnabled(bool enabled)
+{
+    if (m_enabled == enabled)
+        return;
+
+    m_enabled = enabled;
+    emit enabledChanged();
+    evaluate();
+}
+
+void GaugeAlert::setValue(qreal value)
+{
+    if (qFuzzyCompare(m_value, value))
+        return;
+
+    m_value = value;
+    emit valueChanged();
+    evaluate();
+}
+
+void GaugeAlert::setWarningThreshold(qreal threshold)
+{
+    if (qFuzzyCompare(m_warningThreshold, threshold))
+        return;
+
+    m_warningThreshold = threshold;
+    emit thresholdsChanged();
+    evaluate();
+}
+
+void GaugeAlert::setCriticalThreshold(qreal threshold)
+{
+    if (qFuzzyCompare(m_criticalThreshold, threshold))
+        return;
+
+    m_criticalThreshold = threshold;
+    emit thresholdsChanged();
+    evaluate();
+}
+
+void GaugeAlert::setHysteresis(qreal hysteresis)
+{
+    hysteresis = qMax(0.0, hysteresis);
+    if (qFuzzyCompare(m_hysteresis, hysteresis))
+        return;
+
+    m_hysteresis = hysteresis;
+    emit thresholdsChanged();
+    evaluate();
+}
+
+void GaugeAlert::setDwellTime(int ms)
+{
+    ms = qMax(0, ms);
+    if (m_dwellTime == ms)
+        return;
+
+    m_dwellTime = ms;
+    emit dwellTimeChanged();
+    evaluate();
+}
+
+void GaugeAlert::setFlashLevel(Level level)
+{
+    if (m_flashLevel == level)
+        return;
+
+    m_flashLevel = level;
+    emit flashLevelChanged();
+    updateFlashing();
+}
+
+void GaugeAlert::setFlashStyle(FlashStyle style)
+{
+    if (m_flashStyle == style)
+        return;
+
+    // Move between the clock's blink and pulse sets
+    if (m_flashing)
+        GaugeAlerts::instance()->setFlashing(this, false, m_flashStyle);
+    m_flashStyle = style;
+    if (m_flashing)
+        GaugeAlerts::instance()->setFlashing(this, true, m_flashStyle);
+
+    emit flashStyleChanged();
+    emit phaseChanged();
+}
+
+bool GaugeAlert::flashOn() const
+{
+    if (!m_flashing)
+        return true;
+    if (m_flashStyle == Pulse)
+        return GaugeAlerts::instance()->pulse() >= 0.5;
+    return GaugeAlerts::instance()->flashOn();
+}
+
+qreal GaugeAlert::pulse() const
+{
+    if (!m_flashing)
+        return 1.0;
+    if (m_flashStyle == Pulse)
+        return GaugeAlerts::instance()->pulse();
+    return GaugeAlerts::instance()->flashOn() ? 1.0 : 0.0;
+}
+
+// === Evaluation ===
+
+GaugeAlert::Level GaugeAlert::targetLevel() const
+{
+    if (!m_enabled || qIsNaN(m_value))
+        return Normal;
+
+    // Enter at the threshold; leave only hysteresis below it
+    auto reaches = [this](qreal threshold, Level level) {
+        return m_value >= (m_level >= level ? threshold - m_hysteresis : threshold);
+    };
+    if (reaches(m_criticalThreshold, Critical))
+        return Critical;
+    if (reaches(m_warningThreshold, Warning))
+        return Warning;
+    return Normal;
+}
+
+void GaugeAlert::evaluate()
+{
+    if (!m_complete)
+        return;
+
+    const Level target = targetLevel();
+    if (target == m_level) {
+        m_dwellTimer.stop();
+        m_pendingLevel = m_level;
+        return;
+    }
+
+    if (m_dwellTime <= 0) {
+        setLevel(target);
+        return;
+    }
+
+    // Restart the dwell only when the pending level itself changes
+    if (target != m_pendingLevel || !m_dwellTimer.isActive()) {
+        m_pendingLevel = target;
+        m_dwellTimer.start(m_dwellTime);
+    }
+}
+
+void GaugeAlert::setLevel(Level level)
+{
+    m_dwellTimer.stop();
+    m_pendingLevel = level;
+    if (m_level == level)
+        return;
+
+    const Level previous = m_level;
+    m_level = level;
+    GaugeAlerts::instance()->setAlerting(this, isAlerting());
+    updateFlashing();
+
+    emit levelChanged();
+    emit levelEntered(m_level, previous);
+}
+
+void GaugeAlert::updateFlashing()
+{
+    const bool flashing = m_complete && m_flashLevel != Normal && m_level >= m_flashLevel;
+    if (m_flashing == flashing)
+        return;
+
+    m_flashing = flashing;
+    GaugeAlerts::instance()->setFlashing(this, flashing, m_flashStyle);
+    emit flashingChanged();
+    emit phaseChanged();
+}
+
+// === GaugeAlerts ===
+
+// Advances pulsing alerts with the animation driver, i.e. once per frame
+class GaugeAlerts::Clock : public QAbstractAnimation
+{
+public:
+    explicit Clock(GaugeAlerts *alerts)
+        : QAbstractAnimation(alerts)
+        , m_alerts(alerts)
+    {
+    }
+
+    int duration() const override { return -1; }
+
+protected:
+    void updateCurrentTime(int currentTime) override
+    {
+        Q_UNUSED(currentTime)
+        m_alerts->updatePhase();
+    }
+
+private:
+    GaugeAlerts *m_alerts;
+};
+
+GaugeAlerts::GaugeAlerts(QObject *parent)
+    : QObject(parent)
+    , m_clock(new Clock(this))
+{
+    m_epoch.start();
+    m_flashTimer.setSingleShot(true);
+    m_flashTimer.setTimerType(Qt::PreciseTimer);
+    connect(&m_flashTimer, &QTimer::timeout, this, [this]() {
+        updatePhase();
+        scheduleFlash();
+    });
+}
+
+GaugeAlerts *GaugeAlerts::instance()
+{
+    static GaugeAlerts *alerts = new GaugeAlerts;
+    return alerts;
+}
+
+GaugeAlerts *GaugeAlerts::create(QQmlEngine *qmlEngine, QJSEngine *jsEngine)
+{
+    Q_UNUSED(qmlEngine)
+    Q_UNUSED(jsEngine)
+
+    // GaugeAlert reaches the same instance from C++, so QML must not own it
+    GaugeAlerts *alerts = instance();
+    QJSEngine::setObjectOwnership(alerts, QJSEngine::CppOwnership);
+    return alerts;
+}
+
+void GaugeAlerts::setFlashPeriod(int ms)
+{
+    ms = qMax(kMinimumPeriod, ms);
+    if (m_flashPeriod == ms)
+        return;
+
+    m_flashPeriod = ms;
+    emit flashPeriodChanged();
+    updatePhase();
+    scheduleFlash();
+}
+
+void GaugeAlerts::setPulsePeriod(int ms)
+{
+    ms = qMax(kMinimumPeriod, ms);
+    if (m_pulsePeriod == ms)
+        return;
+
+    m_pulsePeriod = ms;
+    emit pulsePeriodChanged();
+    updatePhase();
+}
+
+void GaugeAlerts::setAlerting(GaugeAlert *alert, bool alerting)
+{
+    const qsizetype before = m_alerting.size();
+    if (alerting)
+        m_alerting.insert(alert);
+    else
+        m_alerting.remove(alert);
+
+    if (m_alerting.size() != before)
+        emit alertingCountChanged();
+}
+
+void GaugeAlerts::setFlashing(GaugeAlert *alert, bool flashing, GaugeAlert::FlashStyle style)
+{
+    const bool wasRunning = isRunning();
+    QSet<GaugeAlert *> &set = style == GaugeAlert::Pulse ? m_pulsing : m_blinking;
+    if (flashing)
+        set.insert(alert);
+    else
+        set.remove(alert);
+
+    updatePhase();
+
+    if (m_blinking.isEmpty())
+        m_flashTimer.stop();
+    else if (!m_flashTimer.isActive())
+        scheduleFlash();
+
+    if (m_pulsing.isEmpty())
+        m_clock->stop();
+    else if (m_clock->state() != QAbstractAnimation::Running)
+        m_clock->start();
+
+    if (isRunning() != wasRunning)
+        emit runningChanged();
+}
+
+void GaugeAlerts::scheduleFlash()
+{
+    if (m_blinking.isEmpty())
+        return;
+
+    // Wake exactly at the next half-period boundary of the shared epoch
+    const int half = qMax(1, m_flashPeriod / 2);
+    m_flashTimer.start(int(half - m_epoch.elapsed() % half));
+}
+
+void GaugeAlerts::updatePhase()
+{
+    bool flashOn = true;
+    qreal pulse = 1.0;
+    if (isRunning()) {
+        const qint64 now = m_epoch.elapsed();
+        flashOn = now % m_flashPeriod < m_flashPeriod / 2;
+        const qreal phase = qreal(now % m_pulsePeriod) / m_pulsePeriod;
+        pulse = 0.5 + 0.5 * qCos(2 * M_PI * phase);
+    }
+
+    const bool flashChanged = flashOn != m_flashOn;
+    const bool pulseChanged = !qFuzzyCompare(pulse, m_pulse);
+    m_flashOn = flashOn;
+    m_pulse = pulse;
+    if (!flashChanged && !pulseChanged)
+        return;
+
+    emit phaseChanged();
+
+    // Only alerts whose output actually moved are notified
+    if (flashChanged) {
+        for (GaugeAlert *alert : std::as_const(m_blinking))
+            emit alert->phaseChanged();
+    }
+    if (pulseChanged) {
+        for (GaugeAlert *alert : std::as_const(m_pulsing))
+            emit alert->phaseChanged();
+    }
+}
@@ -0,0 +1,270 @@
+#ifndef GAUGEALERT_H
+#define GAUGEALERT_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QQmlParserStatus>
+#include <QSet>
+#include <QTimer>
+#include <QtQml/qqmlregistration.h>
+
+class QQmlEngine;
+class QJSEngine;
+
+/**
+ * @brief Threshold alert state for one gauge.
+ *
+ * Evaluates value against warningThreshold and criticalThreshold and
+ * reports the result as level. Bind gauge colors to level instead of
+ * comparing value in every binding:
+ *
+ * - hysteresis: a level is entered at its threshold but only left once
+ *   value falls hysteresis units below it, so noise around a threshold
+ *   does not toggle the alert
+ * - dwellTime: a new level is adopted only after value has stayed in it
+ *   for dwellTime milliseconds, in both directions
+ *
+ * Level changes emit levelChanged and levelEntered; nothing is evaluated
+ * per frame. While level is at or above flashLevel the alert is flashing:
+ * flashOn and pulse follow the shared GaugeAlerts clock, so every flashing
+ * gauge is in phase. Otherwise flashOn is true and pulse is 1.
+ *
+ * @example
+ * @code
+ * GaugeAlert {
+ *     id: alert
+ *     value: rpm
+ *     warningThreshold: 6000
+ *     criticalThreshold: 6500
+ *     hysteresis: 100
+ *     dwellTime: 250
+ * }
+ * Text { color: alert.level === GaugeAlert.Critical ? "red" : "white"; opacity: alert.flashOn ? 1 : 0.2 }
+ * @endcode
+ */
+class GaugeAlert : public QObject, public QQmlParserStatus
+{
+    Q_OBJECT
+    QML_ELEMENT
+    Q_INTERFACES(QQmlParserStatus)
+    Q_PROPERTY(bool enabled READ isEnabled WRITE setEnabled NOTIFY enabledChanged)
+    Q_PROPERTY(qreal value READ value WRITE setValue NOTIFY valueChanged)
+    Q_PROPERTY(qreal warningThreshold READ warningThreshold WRITE setWarningThreshold NOTIFY thresholdsChanged)
+    Q_PROPERTY(qreal criticalThreshold READ criticalThreshold WRITE setCriticalThreshold NOTIFY thresholdsChanged)
+    Q_PROPERTY(qreal hysteresis READ hysteresis WRITE setHysteresis NOTIFY thresholdsChanged)
+    Q_PROPERTY(int dwellTime READ dwellTime WRITE setDwellTime NOTIFY dwellTimeChanged)
+    Q_PROPERTY(Level level READ level NOTIFY levelChanged)
+    Q_PROPERTY(bool alerting READ isAlerting NOTIFY levelChanged)
+    Q_PROPERTY(Level flashLevel READ flashLevel WRITE setFlashLevel NOTIFY flashLevelChanged)
+    Q_PROPERTY(FlashStyle flashStyle READ flashStyle WRITE setFlashStyle NOTIFY flashStyleChanged)
+    Q_PROPERTY(bool flashing READ isFlashing NOTIFY flashingChanged)
+    Q_PROPERTY(bool flashOn READ flashOn NOTIFY phaseChanged)
+    Q_PROPERTY(qreal pulse READ pulse NOTIFY phaseChanged)
+
+public:
+    enum Level {
+        Normal,
+        Warning,
+        Critical
+    };
+    Q_ENUM(Level)
+
+    enum FlashStyle {
+        Blink,
+        Pulse
+    };
+    Q_ENUM(FlashStyle)
+
+    explicit GaugeAlert(QObject *parent = nullptr);
+    ~GaugeAlert() override;
+
+    /**
+     * @brief When false, level is Normal.
+     * @default true
+     */
+    bool isEnabled() const { return m_enabled; }
+    void setEnabled(bool enabled);
+
+    qreal value() const { return m_value; }
+    void setValue(qreal value);
+
+    /**
+     * @brief Value at which level becomes Warning.
+     * @default Infinity (never warns)
+     */
+    qreal warningThreshold() const { return m_warningThreshold; }
+    void setWarningThreshold(qreal threshold);
+
+    /**
+     * @brief Value at which level becomes Critical.
+     * @default Infinity (never critical)
+     */
+    qreal criticalThreshold() const { return m_criticalThreshold; }
+    void setCriticalThreshold(qreal threshold);
+
+    /**
+     * @brief Distance below a threshold value must fall to leave its level.
+     * @default 0
+     */
+    qreal hysteresis() const { return m_hysteresis; }
+    void setHysteresis(qreal hysteresis);
+
+    /**
+     * @brief Milliseconds a new level must persist before it is adopted.
+     * @default 0 (immediate)
+     */
+    int dwellTime() const { return m_dwellTime; }
+    void setDwellTime(int ms);
+
+    Level level() const { return m_level; }
+    bool isAlerting() const { return m_level != Normal; }
+
+    /**
+     * @brief Level at and above which the alert flashes; Normal never flashes.
+     * @default GaugeAlert.Critical
+     */
+    Level flashLevel() const { return m_flashLevel; }
+    void setFlashLevel(Level level);
+
+    /**
+     * @brief Blink toggles flashOn; Pulse fades pulse smoothly.
+     * @default GaugeAlert.Blink
+     */
+    FlashStyle flashStyle() const { return m_flashStyle; }
+    void setFlashStyle(FlashStyle style);
+
+    bool isFlashing() const { return m_flashing; }
+
+    /**
+     * @brief Lit half of the shared flash period; true while not flashing.
+     */
+    bool flashOn() const;
+
+    /**
+     * @brief Flash intensity, 0-1; 1 while not flashing.
+     */
+    qreal pulse() const;
+
+    void classBegin() override {}
+    void componentComplete() override;
+
+signals:
+    void enabledChanged();
+    void valueChanged();
+    void thresholdsChanged();
+    void dwellTimeChanged();
+    void levelChanged();
+    void flashLevelChanged();
+    void flashStyleChanged();
+    void flashingChanged();
+    void phaseChanged();
+
+    /**
+     * @brief Emitted once per level change, after level is updated.
+     */
+    void levelEntered(GaugeAlert::Level level, GaugeAlert::Level previous);
+
+private:
+    Level targetLevel() const;
+    void evaluate();
+    void setLevel(Level level);
+    void updateFlashing();
+
+    bool m_enabled = true;
+    qreal m_value = 0.0;
+    qreal m_warningThreshold;
+    qreal m_criticalThreshold;
+    qreal m_hysteresis = 0.0;
+    int m_dwellTime = 0;
+    Level m_level = Normal;
+    Level m_pendingLevel = Normal;
+    Level m_flashLevel = Critical;
+    FlashStyle m_flashStyle = Blink;
+    bool m_flashing = false;
+    bool m_complete = false;
+    QTimer m_dwellTimer;
+};
+
+/**
+ * @brief Global alert state and the shared flash clock.
+ *
+ * Every flashing GaugeAlert takes its phase from this clock, measured from
+ * one epoch, so all gauges blink and pulse together. Blinking only needs a
+ * timer at each half period; pulsing advances with the animation driver.
+ * Neither runs while no alert is flashing, so an idle dashboard requests
+ * no frames.
+ */
+class GaugeAlerts : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_SINGLETON
+    Q_PROPERTY(int flashPeriod READ flashPeriod WRITE setFlashPeriod NOTIFY flashPeriodChanged)
+    Q_PROPERTY(int pulsePeriod READ pulsePeriod WRITE setPulsePeriod NOTIFY pulsePeriodChanged)
+    Q_PROPERTY(bool flashOn READ flashOn NOTIFY phaseChanged)
+    Q_PROPERTY(qreal pulse READ pulse NOTIFY phaseChanged)
+    Q_PROPERTY(bool running READ isRunning NOTIFY runningChanged)
+    Q_PROPERTY(int alertingCount READ alertingCount NOTIFY alertingCountChanged)
+
+public:
+    static GaugeAlerts *instance();
+    static GaugeAlerts *create(QQmlEngine *qmlEngine, QJSEngine *jsEngine);
+
+    /**
+     * @brief Blink period in milliseconds (lit for the first half).
+     * @default 500
+     */
+    int flashPeriod() const { return m_flashPeriod; }
+    void setFlashPeriod(int ms);
+
+    /**
+     * @brief Pulse period in milliseconds (brightest at the start).
+     * @default 1000
+     */
+    int pulsePeriod() const { return m_pulsePeriod; }
+    void setPulsePeriod(int ms);
+
+    bool flashOn() const { return m_flashOn; }
+    qreal pulse() const { return m_pulse; }
+
+    /**
+     * @brief True while any alert is flashing and the clock is running.
+     */
+    bool isRunning() const { return !m_blinking.isEmpty() || !m_pulsing.isEmpty(); }
+
+    /**
+     * @brief Number of alerts currently above Normal.
+     */
+    int alertingCount() const { return int(m_alerting.size()); }
+
+signals:
+    void flashPeriodChanged();
+    void pulsePeriodChanged();
+    void phaseChanged();
+    void runningChanged();
+    void alertingCountChanged();
+
+private:
+    friend class GaugeAlert;
+    class Clock;
+
+    explicit GaugeAlerts(QObject *parent = nullptr);
+
+    void setAlerting(GaugeAlert *alert, bool alerting);
+    void setFlashing(GaugeAlert *alert, bool flashing, GaugeAlert::FlashStyle style);
+    void scheduleFlash();
+    void updatePhase();
+
+    QElapsedTimer m_epoch;
+    QTimer m_flashTimer;
+    Clock *m_clock = nullptr;
+    int m_flashPeriod = 500;
+    int m_pulsePeriod = 1000;
+    bool m_flashOn = true;
+    qreal m_pulse = 1.0;
+    QSet<GaugeAlert *> m_alerting;
+    QSet<GaugeAlert *> m_blinking;
+    QSet<GaugeAlert *> m_pulsing;
+};
+
+#endif // GAUGEALERT_H
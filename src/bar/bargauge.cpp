@@ -0,0 +1,586 @@
+#include "bargauge.h"
+
+#include "../theme/gaugetheme.h"
+
+#include <QQuickWindow>
+#include <QSGGeometryNode>
+#include <QSGRectangleNode>
+#include <QSGRendererInterface>
+#include <QSGVertexColorMaterial>
+#include <QtMath>
+
+namespace {
+
+constexpr int kMaxSegments = 500;
+constexpr int kVerticesPerSegment = 8;  // Lit quad + unlit quad
+constexpr int kIndicesPerSegment = 12;
+
+struct PremultipliedColor {
+    uchar r, g, b, a;
+};
+
+PremultipliedColor premultiplied(const QColor &color, qreal opacity)
+{
+    const QColor rgb = color.toRgb();
+    const qreal alpha = rgb.alphaF() * opacity;
+    return {uchar(qRound(rgb.red() * alpha)), uchar(qRound(rgb.green() * alpha)),
+            uchar(qRound(rgb.blue() * alpha)), uchar(qRound(alpha * 255))};
+}
+
+} // namespace
+
+BarGauge::BarGauge(QQuickItem *parent)
+    : QQuickItem(parent)
+    , m_normalColor(0x00, 0xaa, 0xff)
+    , m_warningColor(0xff, 0xaa, 0x00)
+    , m_criticalColor(0xff, 0x44, 0x44)
+    , m_peakColor(0xff, 0xff, 0xff)
+{
+    setFlag(ItemHasContents, true);
+
+    m_peakTimer.setSingleShot(true);
+    connect(&m_peakTimer, &QTimer::timeout, this, [this]() {
+        if (m_peakValue != m_value) {
+            m_peakValue = m_value;
+            emit peakValueChanged();
+            valueStateChanged();
+        }
+    });
+}
+
+// === Value ===
+
+void BarGauge::setValue(qreal value)
+{
+    if (qFuzzyCompare(m_value, value))
+        return;
+
+    m_value = value;
+    emit valueChanged();
+
+    updatePeak();
+    valueStateChanged();
+}
+
+void BarGauge::setMinValue(qreal minValue)
+{
+    if (qFuzzyCompare(m_minValue, minValue))
+        return;
+
+    m_minValue = minValue;
+    emit minValueChanged();
+    invalidateSegments();
+}
+
+void BarGauge::setMaxValue(qreal maxValue)
+{
+    if (qFuzzyCompare(m_maxValue, maxValue))
+        return;
+
+    m_maxValue = maxValue;
+    emit maxValueChanged();
+    if (!m_warningThresholdSet)
+        emit warningThresholdChanged();
+    if (!m_redlineStartSet)
+        emit redlineStartChanged();
+    invalidateSegments();
+}
+
+qreal BarGauge::warningThreshold() const
+{
+    return m_warningThresholdSet ? m_warningThreshold : m_maxValue;
+}
+
+void BarGauge::setWarningThreshold(qreal threshold)
+{
+    if (m_warningThresholdSet && qFuzzyCompare(m_warningThreshold, threshold))
+        return;
+
+    m_warningThreshold = threshold;
+    m_warningThresholdSet = true;
+    emit warningThresholdChanged();
+    invalidateSegments();
+}
+
+qreal BarGauge::redlineStart() const
+{
+    return m_redlineStartSet ? m_redlineStart : m_maxValue;
+}
+
+void BarGauge::setRedlineStart(qreal start)
+{
+    if (m_redlineStartSet && qFuzzyCompare(m_redlineStart, start))
+        return;
+
+    m_redlineStart = start;
+    m_redlineStartSet = true;
+    emit redlineStartChanged();
+    invalidateSegments();
+}
+
+// === Layout ===
+
+void BarGauge::setSegmentCount(int count)
+{
+    count = qBound(1, count, kMaxSegments);
+    if (m_segmentCount == count)
+        return;
+
+    m_segmentCount = count;
+    emit segmentCountChanged();
+    invalidateSegments();
+}
+
+void BarGauge::setSegmentSpacing(qreal spacing)
+{
+    spacing = qMax(0.0, spacing);
+    if (qFuzzyCompare(m_segmentSpacing, spacing))
+        return;
+
+    m_segmentSpacing = spacing;
+    emit segmentSpacingChanged();
+    invalidateSegments();
+}
+
+void BarGauge::setVertical(bool vertical)
+{
+    if (m_vertical == vertical)
+        return;
+
+    m_vertical = vertical;
+    emit verticalChanged();
+    invalidateSegments();
+}
+
+void BarGauge::setContinuous(bool continuous)
+{
+    if (m_continuous == continuous)
+        return;
+
+    m_continuous = continuous;
+    emit continuousChanged();
+    invalidateSegments();
+}
+
+// === Peak ===
+
+void BarGauge::setPeakHold(bool enabled)
+{
+    if (m_peakHold == enabled)
+        return;
+
+    m_peakHold = enabled;
+    emit peakHoldChanged();
+    resetPeak();
+}
+
+void BarGauge::setPeakHoldTime(int ms)
+{
+    ms = qMax(0, ms);
+    if (m_peakHoldTime == ms)
+        return;
+
+    m_peakHoldTime = ms;
+    emit peakHoldTimeChanged();
+}
+
+void BarGauge::resetPeak()
+{
+    m_peakTimer.stop();
+    if (m_peakValue != m_value) {
+        m_peakValue = m_value;
+        emit peakValueChanged();
+    }
+    valueStateChanged();
+}
+
+void BarGauge::updatePeak()
+{
+    if (!m_peakHold)
+        return;
+
+    if (m_value >= m_peakValue) {
+        // New maximum: hold it for peakHoldTime from now
+        m_peakValue = m_value;
+        emit peakValueChanged();
+        if (m_peakHoldTime > 0)
+            m_peakTimer.start(m_peakHoldTime);
+    } else if (m_peakHoldTime > 0 && !m_peakTimer.isActive()) {
+        // Hold expired: the peak follows the value down
+        m_peakValue = m_value;
+        emit peakValueChanged();
+    }
+}
+
+// === Colors ===
+
+void BarGauge::setNormalColor(const QColor &color)
+{
+    m_explicitColors |= ExplicitNormal;
+    if (m_normalColor == color)
+        return;
+
+    m_normalColor = color;
+    emit normalColorChanged();
+    invalidateSegments();
+}
+
+void BarGauge::setWarningColor(const QColor &color)
+{
+    m_explicitColors |= ExplicitWarning;
+    if (m_warningColor == color)
+        return;
+
+    m_warningColor = color;
+    emit warningColorChanged();
+    invalidateSegments();
+}
+
+void BarGauge::setCriticalColor(const QColor &color)
+{
+    m_explicitColors |= ExplicitCritical;
+    if (m_criticalColor == color)
+        return;
+
+    m_criticalColor = color;
+    emit criticalColorChanged();
+    invalidateSegments();
+}
+
+void BarGauge::setPeakColor(const QColor &color)
+{
+    m_explicitColors |= ExplicitPeak;
+    if (m_peakColor == color)
+        return;
+
+    m_peakColor = color;
+    emit peakColorChanged();
+    invalidateSegments();
+}
+
+void BarGauge::setUnlitOpacity(qreal opacity)
+{
+    opacity = qBound(0.0, opacity, 1.0);
+    if (qFuzzyCompare(m_unlitOpacity, opacity))
+        return;
+
+    m_unlitOpacity = opacity;
+    emit unlitOpacityChanged();
+    invalidateSegments();
+}
+
+void BarGauge::syncThemeColors()
+{
+    if (!m_theme)
+        return;
+
+    bool changed = false;
+    auto follow = [&](QColor &color, const QColor &themed, int flag, void (BarGauge::*notify)()) {
+        if ((m_explicitColors & flag) || color == themed)
+            return;
+        color = themed;
+        emit (this->*notify)();
+        changed = true;
+    };
+
+    follow(m_normalColor, m_theme->valueArcColor(), ExplicitNormal, &BarGauge::normalColorChanged);
+    follow(m_warningColor, m_theme->warningColor(), ExplicitWarning, &BarGauge::warningColorChanged);
+    follow(m_criticalColor, m_theme->criticalColor(), ExplicitCritical, &BarGauge::criticalColorChanged);
+    follow(m_peakColor, m_theme->needleColor(), ExplicitPeak, &BarGauge::peakColorChanged);
+
+    if (changed)
+        invalidateSegments();
+}
+
+// === Item ===
+
+void BarGauge::componentComplete()
+{
+    QQuickItem::componentComplete();
+
+    m_theme = qobject_cast<GaugeThemeAttached *>(qmlAttachedPropertiesObject<GaugeTheme>(this));
+    if (m_theme)
+        connect(m_theme, &GaugeThemeAttached::paletteChanged, this, &BarGauge::syncThemeColors);
+    syncThemeColors();
+    valueStateChanged();
+}
+
+void BarGauge::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size())
+        invalidateSegments();
+}
+
+void BarGauge::invalidateSegments()
+{
+    m_segmentsDirty = true;
+    valueStateChanged();
+    update();
+}
+
+void BarGauge::valueStateChanged()
+{
+    const qreal level = normalized(m_value) * m_segmentCount;
+    const int lit = m_continuous ? qCeil(level) : qRound(level);
+    const int peak = peakSegment();
+
+    bool changed = m_continuous;  // The boundary segment's fill moves continuously
+    if (lit != m_litSegments) {
+        m_litSegments = lit;
+        emit litSegmentsChanged();
+        changed = true;
+    }
+    if (peak != m_peakSegment) {
+        m_peakSegment = peak;
+        changed = true;
+    }
+
+    // LED bars do not request a frame unless a segment actually toggles
+    if (changed)
+        update();
+}
+
+qreal BarGauge::normalized(qreal value) const
+{
+    const qreal range = m_maxValue - m_minValue;
+    if (range <= 0.0)
+        return 0.0;
+    return qBound(0.0, (value - m_minValue) / range, 1.0);
+}
+
+int BarGauge::peakSegment() const
+{
+    if (!m_peakHold)
+        return -1;
+
+    const qreal level = normalized(m_peakValue) * m_segmentCount;
+    return (m_continuous ? qCeil(level) : qRound(level)) - 1;
+}
+
+BarGauge::SegmentState BarGauge::segmentState(int index) const
+{
+    SegmentState state;
+    if (m_continuous) {
+        const qreal level = normalized(m_value) * m_segmentCount;
+        state.litFraction = float(qBound(0.0, level - index, 1.0));
+    } else {
+        state.litFraction = index < m_litSegments ? 1.0f : 0.0f;
+    }
+
+    // The peak marker only shows above the lit part of the bar
+    state.peak = index == m_peakSegment && state.litFraction < 1.0f;
+    return state;
+}
+
+QColor BarGauge::zoneColor(int index) const
+{
+    const qreal segmentStart = m_minValue + (m_maxValue - m_minValue) * index / m_segmentCount;
+    if (segmentStart >= redlineStart())
+        return m_criticalColor;
+    if (segmentStart >= warningThreshold())
+        return m_warningColor;
+    return m_normalColor;
+}
+
+void BarGauge::segmentRects(int index, const SegmentState &state, QRectF *lit, QRectF *unlit) const
+{
+    const int count = m_segmentCount;
+    const qreal w = width();
+    const qreal h = height();
+    const qreal length = m_vertical ? h : w;
+
+    // Drop the gaps if they would not leave room for the segments
+    const qreal spacing = m_segmentSpacing * (count - 1) < length ? m_segmentSpacing : 0.0;
+    const qreal segmentLength = (length - spacing * (count - 1)) / count;
+    const qreal start = index * (segmentLength + spacing);
+    const qreal split = start + segmentLength * state.litFraction;
+    const qreal end = start + segmentLength;
+
+    if (m_vertical) {
+        // Fill bottom-to-top
+        *lit = QRectF(QPointF(0, h - split), QPointF(w, h - start));
+        *unlit = QRectF(QPointF(0, h - end), QPointF(w, h - split));
+    } else {
+        *lit = QRectF(QPointF(start, 0), QPointF(split, h));
+        *unlit = QRectF(QPointF(split, 0), QPointF(end, h));
+    }
+}
+
+void BarGauge::segmentColors(int index, const SegmentState &state, QColor *lit, QColor *unlit) const
+{
+    *lit = state.peak ? m_peakColor : zoneColor(index);
+    *unlit = *lit;
+    if (!state.peak)
+        unlit->setAlphaF(float(lit->alphaF() * m_unlitOpacity));
+}
+
+void BarGauge::writeSegment(QSGGeometry::ColoredPoint2D *vertices, int index,
+                            const SegmentState &state) const
+{
+    QRectF litRect;
+    QRectF unlitRect;
+    segmentRects(index, state, &litRect, &unlitRect);
+    QColor litColor;
+    QColor unlitColor;
+    segmentColors(index, state, &litColor, &unlitColor);
+
+    auto setQuad = [](QSGGeometry::ColoredPoint2D *quad, const QRectF &rect, const QColor &color) {
+        const PremultipliedColor c = premultiplied(color, 1.0);
+        const float left = float(rect.left());
+        const float top = float(rect.top());
+        const float right = float(rect.right());
+        const float bottom = float(rect.bottom());
+        quad[0].set(left, top, c.r, c.g, c.b, c.a);
+        quad[1].set(left, bottom, c.r, c.g, c.b, c.a);
+        quad[2].set(right, top, c.r, c.g, c.b, c.a);
+        quad[3].set(right, bottom, c.r, c.g, c.b, c.a);
+    };
+
+    setQuad(vertices, litRect, litColor);
+    setQuad(vertices + 4, unlitRect, unlitColor);
+}
+
+QSGNode *BarGauge::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data)
+{
+    Q_UNUSED(data)
+
+    if (width() <= 0 || height() <= 0) {
+        delete oldNode;
+        m_segmentsDirty = true;
+        return nullptr;
+    }
+
+    if (window()->rendererInterface()->graphicsApi() == QSGRendererInterface::Software)
+        return updateRectangleNodes(oldNode);
+
+    const int count = m_segmentCount;
+    auto *node = static_cast<QSGGeometryNode *>(oldNode);
+    if (!node) {
+        node = new QSGGeometryNode;
+        node->setMaterial(new QSGVertexColorMaterial);
+        node->setFlag(QSGNode::OwnsMaterial);
+        node->setFlag(QSGNode::OwnsGeometry);
+        m_segmentsDirty = true;
+    }
+
+    QSGGeometry *geometry = node->geometry();
+    if (m_segmentsDirty) {
+        const int vertexCount = count * kVerticesPerSegment;
+        const int indexCount = count * kIndicesPerSegment;
+        if (!geometry) {
+            geometry = new QSGGeometry(QSGGeometry::defaultAttributes_ColoredPoint2D(),
+                                       vertexCount, indexCount, QSGGeometry::UnsignedShortType);
+            geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+            geometry->setVertexDataPattern(QSGGeometry::DynamicPattern);
+            geometry->setIndexDataPattern(QSGGeometry::StaticPattern);
+            node->setGeometry(geometry);
+        } else if (geometry->vertexCount() != vertexCount) {
+            geometry->allocate(vertexCount, indexCount);
+        }
+
+        // Two quads per segment, two triangles per quad
+        quint16 *indices = geometry->indexDataAsUShort();
+        for (int quad = 0; quad < count * 2; ++quad) {
+            const quint16 base = quint16(quad * 4);
+            quint16 *out = indices + quad * 6;
+            out[0] = base;
+            out[1] = base + 1;
+            out[2] = base + 2;
+            out[3] = base + 2;
+            out[4] = base + 1;
+            out[5] = base + 3;
+        }
+        geometry->markIndexDataDirty();
+
+        // Invalid states force every segment to be written below
+        m_segmentStates.assign(count, SegmentState());
+        m_segmentsDirty = false;
+    }
+
+    QSGGeometry::ColoredPoint2D *vertices = geometry->vertexDataAsColoredPoint2D();
+    int updated = 0;
+    for (int i = 0; i < count; ++i) {
+        const SegmentState state = segmentState(i);
+        if (state == m_segmentStates[i])
+            continue;
+        writeSegment(vertices + i * kVerticesPerSegment, i, state);
+        m_segmentStates[i] = state;
+        ++updated;
+    }
+
+    if (updated > 0) {
+        geometry->markVertexDataDirty();
+        node->markDirty(QSGNode::DirtyGeometry);
+    }
+
+    reportUpdatedSegments(updated);
+    return node;
+}
+
+// The software renderer skips custom geometry but draws rectangle nodes
+QSGNode *BarGauge::updateRectangleNodes(QSGNode *oldNode)
+{
+    const int count = m_segmentCount;
+    QSGNode *node = oldNode;
+    if (!node) {
+        node = new QSGNode;
+        m_segmentsDirty = true;
+    }
+
+    if (m_segmentsDirty) {
+        // A lit and an unlit rectangle per segment, in segment order
+        const int rectangles = count * 2;
+        while (node->childCount() > rectangles) {
+            QSGNode *last = node->lastChild();
+            node->removeChildNode(last);
+            delete last;
+        }
+        while (node->childCount() < rectangles)
+            node->appendChildNode(window()->createRectangleNode());
+
+        m_segmentStates.assign(count, SegmentState());
+        m_segmentsDirty = false;
+    }
+
+    int updated = 0;
+    QSGNode *child = node->firstChild();
+    for (int i = 0; i < count; ++i) {
+        auto *lit = static_cast<QSGRectangleNode *>(child);
+        auto *unlit = static_cast<QSGRectangleNode *>(lit->nextSibling());
+        child = unlit->nextSibling();
+
+        const SegmentState state = segmentState(i);
+        if (state == m_segmentStates[i])
+            continue;
+
+        QRectF litRect;
+        QRectF unlitRect;
+        segmentRects(i, state, &litRect, &unlitRect);
+        QColor litColor;
+        QColor unlitColor;
+        segmentColors(i, state, &litColor, &unlitColor);
+        lit->setRect(litRect);
+        lit->setColor(litColor);
+        unlit->setRect(unlitRect);
+        unlit->setColor(unlitColor);
+
+        m_segmentStates[i] = state;
+        ++updated;
+    }
+
+    reportUpdatedSegments(updated);
+    return node;
+}
+
+void BarGauge::reportUpdatedSegments(int updated)
+{
+    // Runs on the render thread; report back on the GUI thread
+    if (updated != m_syncedSegments) {
+        m_syncedSegments = updated;
+        QMetaObject::invokeMethod(this, [this, updated]() {
+            m_lastUpdatedSegments = updated;
+            emit lastUpdatedSegmentsChanged();
+        }, Qt::QueuedConnection);
+    }
+}
@@ -0,0 +1,283 @@
+#ifndef BARGAUGE_H
+#define BARGAUGE_H
+
+#include <QColor>
+#include <QPointer>
+#include <QQuickItem>
+#include <QSGGeometry>
+#include <QTimer>
+#include <QtQml/qqmlregistration.h>
+
+#include <vector>
+
+class GaugeThemeAttached;
+
+/**
+ * @brief Linear or LED-segment bar gauge (shift lights, bar graphs).
+ *
+ * All segments are drawn by one QSGGeometryNode with per-vertex colors,
+ * so a 120-segment bar is a single draw call with no per-segment items or
+ * bindings. Each segment has a lit and an unlit part:
+ * - LED style (continuous: false): segments are fully lit or unlit
+ * - Linear style (continuous: true): the boundary segment is partially lit;
+ *   use segmentCount: 1 and segmentSpacing: 0 for a plain bar
+ *
+ * A value change only rewrites the vertices of segments whose state
+ * changed, and does not schedule a frame at all when no segment changes.
+ *
+ * The software renderer cannot draw vertex-colored geometry. On that
+ * backend each segment is a lit and an unlit rectangle node instead, and
+ * only the rectangles of changed segments are updated.
+ *
+ * Zones follow the library threshold semantics: a segment takes
+ * warningColor once its start value reaches warningThreshold and
+ * criticalColor once it reaches redlineStart. Colors default to the
+ * active GaugeTheme until assigned.
+ *
+ * @example
+ * @code
+ * BarGauge {
+ *     width: 400; height: 24
+ *     value: dataBroker.rpm
+ *     maxValue: 8000
+ *     warningThreshold: 6000
+ *     redlineStart: 7000
+ *     segmentCount: 60
+ *     peakHold: true
+ * }
+ * @endcode
+ */
+class BarGauge : public QQuickItem
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+    // Value
+    Q_PROPERTY(qreal value READ value WRITE setValue NOTIFY valueChanged)
+    Q_PROPERTY(qreal minValue READ minValue WRITE setMinValue NOTIFY minValueChanged)
+    Q_PROPERTY(qreal maxValue READ maxValue WRITE setMaxValue NOTIFY maxValueChanged)
+    Q_PROPERTY(qreal warningThreshold READ warningThreshold WRITE setWarningThreshold NOTIFY warningThresholdChanged)
+    Q_PROPERTY(qreal redlineStart READ redlineStart WRITE setRedlineStart NOTIFY redlineStartChanged)
+
+    // Layout
+    Q_PROPERTY(int segmentCount READ segmentCount WRITE setSegmentCount NOTIFY segmentCountChanged)
+    Q_PROPERTY(qreal segmentSpacing READ segmentSpacing WRITE setSegmentSpacing NOTIFY segmentSpacingChanged)
+    Q_PROPERTY(bool vertical READ isVertical WRITE setVertical NOTIFY verticalChanged)
+    Q_PROPERTY(bool continuous READ isContinuous WRITE setContinuous NOTIFY continuousChanged)
+
+    // Peak
+    Q_PROPERTY(bool peakHold READ peakHold WRITE setPeakHold NOTIFY peakHoldChanged)
+    Q_PROPERTY(int peakHoldTime READ peakHoldTime WRITE setPeakHoldTime NOTIFY peakHoldTimeChanged)
+    Q_PROPERTY(qreal peakValue READ peakValue NOTIFY peakValueChanged)
+
+    // Colors
+    Q_PROPERTY(QColor normalColor READ normalColor WRITE setNormalColor NOTIFY normalColorChanged)
+    Q_PROPERTY(QColor warningColor READ warningColor WRITE setWarningColor NOTIFY warningColorChanged)
+    Q_PROPERTY(QColor criticalColor READ criticalColor WRITE setCriticalColor NOTIFY criticalColorChanged)
+    Q_PROPERTY(QColor peakColor READ peakColor WRITE setPeakColor NOTIFY peakColorChanged)
+    Q_PROPERTY(qreal unlitOpacity READ unlitOpacity WRITE setUnlitOpacity NOTIFY unlitOpacityChanged)
+
+    // Diagnostics
+    Q_PROPERTY(int litSegments READ litSegments NOTIFY litSegmentsChanged)
+    Q_PROPERTY(int lastUpdatedSegments READ lastUpdatedSegments NOTIFY lastUpdatedSegmentsChanged)
+
+public:
+    explicit BarGauge(QQuickItem *parent = nullptr);
+
+    qreal value() const { return m_value; }
+    void setValue(qreal value);
+    qreal minValue() const { return m_minValue; }
+    void setMinValue(qreal minValue);
+    qreal maxValue() const { return m_maxValue; }
+    void setMaxValue(qreal maxValue);
+
+    /**
+     * @brief Value where the warning zone starts.
+     * @default maxValue
+     */
+    qreal warningThreshold() const;
+    void setWarningThreshold(qreal threshold);
+
+    /**
+     * @brief Value where the critical/redline zone starts.
+     * @default maxValue
+     */
+    qreal redlineStart() const;
+    void setRedlineStart(qreal start);
+
+    /**
+     * @brief Number of segments (1-500).
+     * @default 40
+     */
+    int segmentCount() const { return m_segmentCount; }
+    void setSegmentCount(int count);
+
+    /**
+     * @brief Gap between segments in pixels.
+     * @default 2
+     */
+    qreal segmentSpacing() const { return m_segmentSpacing; }
+    void setSegmentSpacing(qreal spacing);
+
+    /**
+     * @brief Fill bottom-to-top instead of left-to-right.
+     * @default false
+     */
+    bool isVertical() const { return m_vertical; }
+    void setVertical(bool vertical);
+
+    /**
+     * @brief Partially light the boundary segment (linear bar) instead of
+     * whole segments only (LED bar).
+     * @default false
+     */
+    bool isContinuous() const { return m_continuous; }
+    void setContinuous(bool continuous);
+
+    /**
+     * @brief Show a peak marker segment at the highest recent value.
+     * @default false
+     */
+    bool peakHold() const { return m_peakHold; }
+    void setPeakHold(bool enabled);
+
+    /**
+     * @brief Time in ms the peak is held before dropping to the current value.
+     * 0 holds until resetPeak().
+     * @default 1500
+     */
+    int peakHoldTime() const { return m_peakHoldTime; }
+    void setPeakHoldTime(int ms);
+
+    qreal peakValue() const { return m_peakValue; }
+
+    QColor normalColor() const { return m_normalColor; }
+    void setNormalColor(const QColor &color);
+    QColor warningColor() const { return m_warningColor; }
+    void setWarningColor(const QColor &color);
+    QColor criticalColor() const { return m_criticalColor; }
+    void setCriticalColor(const QColor &color);
+    QColor peakColor() const { return m_peakColor; }
+    void setPeakColor(const QColor &color);
+
+    /**
+     * @brief Opacity of unlit segments, which show their dimmed zone color.
+     * @default 0.15
+     */
+    qreal unlitOpacity() const { return m_unlitOpacity; }
+    void setUnlitOpacity(qreal opacity);
+
+    /**
+     * @brief Number of fully or partially lit segments.
+     */
+    int litSegments() const { return m_litSegments; }
+
+    /**
+     * @brief Segments rewritten by the most recent scene graph update.
+     */
+    int lastUpdatedSegments() const { return m_lastUpdatedSegments; }
+
+    /**
+     * @brief Drop the held peak to the current value.
+     */
+    Q_INVOKABLE void resetPeak();
+
+signals:
+    void valueChanged();
+    void minValueChanged();
+    void maxValueChanged();
+    void warningThresholdChanged();
+    void redlineStartChanged();
+    void segmentCountChanged();
+    void segmentSpacingChanged();
+    void verticalChanged();
+    void continuousChanged();
+    void peakHoldChanged();
+    void peakHoldTimeChanged();
+    void peakValueChanged();
+    void normalColorChanged();
+    void warningColorChanged();
+    void criticalColorChanged();
+    void peakColorChanged();
+    void unlitOpacityChanged();
+    void litSegmentsChanged();
+    void lastUpdatedSegmentsChanged();
+
+protected:
+    void componentComplete() override;
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) override;
+
+private:
+    enum ExplicitColor {
+        ExplicitNormal = 0x1,
+        ExplicitWarning = 0x2,
+        ExplicitCritical = 0x4,
+        ExplicitPeak = 0x8
+    };
+
+    // What a segment looks like; segments are only rewritten when this changes
+    struct SegmentState {
+        float litFraction = -1.0f;
+        bool peak = false;
+
+        bool operator==(const SegmentState &other) const
+        {
+            return litFraction == other.litFraction && peak == other.peak;
+        }
+    };
+
+    qreal normalized(qreal value) const;
+    SegmentState segmentState(int index) const;
+    QColor zoneColor(int index) const;
+    int peakSegment() const;
+    void segmentRects(int index, const SegmentState &state, QRectF *lit, QRectF *unlit) const;
+    void segmentColors(int index, const SegmentState &state, QColor *lit, QColor *unlit) const;
+    void writeSegment(QSGGeometry::ColoredPoint2D *vertices, int index,
+                      const SegmentState &state) const;
+    QSGNode *updateRectangleNodes(QSGNode *oldNode);
+    void reportUpdatedSegments(int updated);
+
+    void valueStateChanged();
+    void invalidateSegments();
+    void syncThemeColors();
+    void updatePeak();
+
+    qreal m_value = 0.0;
+    qreal m_minValue = 0.0;
+    qreal m_maxValue = 100.0;
+    qreal m_warningThreshold = 0.0;
+    qreal m_redlineStart = 0.0;
+    bool m_warningThresholdSet = false;
+    bool m_redlineStartSet = false;
+
+    int m_segmentCount = 40;
+    qreal m_segmentSpacing = 2.0;
+    bool m_vertical = false;
+    bool m_continuous = false;
+
+    bool m_peakHold = false;
+    int m_peakHoldTime = 1500;
+    qreal m_peakValue = 0.0;
+    QTimer m_peakTimer;
+
+    QColor m_normalColor;
+    QColor m_warningColor;
+    QColor m_criticalColor;
+    QColor m_peakColor;
+    qreal m_unlitOpacity = 0.15;
+    int m_explicitColors = 0;
+    QPointer<GaugeThemeAttached> m_theme;
+
+    int m_litSegments = 0;
+    int m_peakSegment = -1;
+    int m_lastUpdatedSegments = 0;
+
+    // Scene graph state. m_segmentsDirty forces every segment (and the
+    // index buffer) to be rewritten on the next sync.
+    std::vector<SegmentState> m_segmentStates;
+    int m_syncedSegments = 0;
+    bool m_segmentsDirty = true;
+};
+
+#endif // BARGAUGE_H
@@ -0,0 +1,450 @@
+#include "gaugecluster.h"
+
+#include <QDebug>
+#include <QQuickWindow>
+#include <QtMath>
+
+#include <cmath>
+
+namespace {
+
+constexpr int kStatisticsInterval = 1000;  // ms
+
+// Golden-ratio sequence: evenly spread phases for any number of gauges
+constexpr qreal kPhaseStep = 0.6180339887498949;
+
+} // namespace
+
+// === GaugeClusterAttached ===
+
+GaugeClusterAttached::GaugeClusterAttached(QObject *parent)
+    : QObject(parent)
+{
+    // The item is not parented yet while its attached properties are set,
+    // so the cluster is looked up on first use and again on reparenting
+    if (QQuickItem *gauge = item()) {
+        connect(gauge, &QQuickItem::parentChanged, this, [this]() {
+            m_clusterResolved = false;
+            resolveCluster();
+        });
+    }
+}
+
+GaugeClusterAttached::~GaugeClusterAttached()
+{
+    if (m_cluster)
+        m_cluster->unregisterGauge(this);
+}
+
+QQuickItem *GaugeClusterAttached::item() const
+{
+    return qobject_cast<QQuickItem *>(parent());
+}
+
+void GaugeClusterAttached::resolveCluster()
+{
+    if (m_clusterResolved)
+        return;
+    m_clusterResolved = true;
+
+    GaugeCluster *cluster = nullptr;
+    if (QQuickItem *gauge = item()) {
+        for (QQuickItem *ancestor = gauge->parentItem(); ancestor && !cluster;
+             ancestor = ancestor->parentItem())
+            cluster = qobject_cast<GaugeCluster *>(ancestor);
+    }
+
+    if (cluster == m_cluster)
+        return;
+    if (m_cluster)
+        m_cluster->unregisterGauge(this);
+    m_cluster = cluster;
+    if (m_cluster)
+        m_cluster->registerGauge(this);
+}
+
+void GaugeClusterAttached::setSource(qreal source)
+{
+    if (qFuzzyCompare(m_source, source))
+        return;
+
+    m_source = source;
+    emit sourceChanged();
+
+    const GaugeCluster *previous = m_cluster;
+    resolveCluster();
+    if (!m_cluster)
+        write();
+    else if (m_cluster == previous)
+        m_cluster->sourceChanged(this);
+    // else: registerGauge() already handled the first value
+}
+
+void GaugeClusterAttached::setTargetProperty(const QString &name)
+{
+    if (m_targetProperty == name)
+        return;
+
+    m_targetProperty = name;
+    m_target = QMetaProperty();
+    emit targetPropertyChanged();
+}
+
+void GaugeClusterAttached::setPriority(int priority)
+{
+    priority = qBound<int>(GaugeCluster::High, priority, GaugeCluster::Low);
+    if (m_priority == priority)
+        return;
+
+    m_priority = priority;
+    emit priorityChanged();
+    emit targetUpdateRateChanged();
+    if (m_cluster)
+        m_cluster->rateChanged(this);
+}
+
+void GaugeClusterAttached::setUpdateRate(qreal rate)
+{
+    if (qFuzzyCompare(m_updateRate, rate))
+        return;
+
+    m_updateRate = rate;
+    emit updateRateChanged();
+    emit targetUpdateRateChanged();
+    if (m_cluster)
+        m_cluster->rateChanged(this);
+}
+
+qreal GaugeClusterAttached::targetUpdateRate() const
+{
+    if (m_updateRate >= 0.0 || !m_cluster)
+        return qMax(0.0, m_updateRate);
+    return m_cluster->rateFor(this);
+}
+
+void GaugeClusterAttached::write()
+{
+    QQuickItem *gauge = item();
+    if (!gauge)
+        return;
+
+    if (!m_target.isValid()) {
+        const QMetaObject *metaObject = gauge->metaObject();
+        const int index = metaObject->indexOfProperty(m_targetProperty.toUtf8().constData());
+        if (index < 0) {
+            qWarning() << "GaugeCluster:" << metaObject->className() << "has no property"
+                       << m_targetProperty;
+            return;
+        }
+        m_target = metaObject->property(index);
+    }
+
+    m_target.write(gauge, m_source);
+}
+
+// === GaugeCluster ===
+
+GaugeCluster::GaugeCluster(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+    m_clock.start();
+
+    m_scheduler.setSingleShot(true);
+    m_scheduler.setTimerType(Qt::PreciseTimer);
+    connect(&m_scheduler, &QTimer::timeout, this, &GaugeCluster::runScheduler);
+
+    m_statistics.setInterval(kStatisticsInterval);
+    connect(&m_statistics, &QTimer::timeout, this, &GaugeCluster::updateStatistics);
+}
+
+GaugeCluster::~GaugeCluster()
+{
+    for (GaugeClusterAttached *gauge : std::as_const(m_gauges))
+        gauge->m_cluster = nullptr;
+}
+
+GaugeClusterAttached *GaugeCluster::qmlAttachedProperties(QObject *object)
+{
+    return new GaugeClusterAttached(object);
+}
+
+void GaugeCluster::setRate(Priority priority, qreal rate)
+{
+    rate = qMax(0.0, rate);
+    if (qFuzzyCompare(m_rates[priority], rate))
+        return;
+
+    m_rates[priority] = rate;
+    emit ratesChanged();
+
+    for (GaugeClusterAttached *gauge : std::as_const(m_gauges)) {
+        if (gauge->m_priority == priority && gauge->m_updateRate < 0.0) {
+            emit gauge->targetUpdateRateChanged();
+            rateChanged(gauge);
+        }
+    }
+}
+
+void GaugeCluster::setHighUpdateRate(qreal rate) { setRate(High, rate); }
+void GaugeCluster::setNormalUpdateRate(qreal rate) { setRate(Normal, rate); }
+void GaugeCluster::setLowUpdateRate(qreal rate) { setRate(Low, rate); }
+
+void GaugeCluster::setCulling(bool enabled)
+{
+    if (m_culling == enabled)
+        return;
+
+    m_culling = enabled;
+    emit cullingChanged();
+    updateCulling();
+}
+
+QQmlListProperty<QQuickItem> GaugeCluster::occluders()
+{
+    return QQmlListProperty<QQuickItem>(this, &m_occluders);
+}
+
+QVariantList GaugeCluster::updateRates() const
+{
+    QVariantList report;
+    report.reserve(m_gauges.size());
+    for (const GaugeClusterAttached *gauge : m_gauges) {
+        report.append(QVariantMap {
+            {QStringLiteral("gauge"), QVariant::fromValue(gauge->item())},
+            {QStringLiteral("priority"), gauge->m_priority},
+            {QStringLiteral("targetRate"), gauge->targetUpdateRate()},
+            {QStringLiteral("effectiveRate"), gauge->m_effectiveRate},
+            {QStringLiteral("culled"), gauge->m_culled},
+        });
+    }
+    return report;
+}
+
+void GaugeCluster::itemChange(ItemChange change, const ItemChangeData &data)
+{
+    QQuickItem::itemChange(change, data);
+
+    if (change == ItemSceneChange) {
+        disconnect(m_frameConnection);
+        // Scrolling, layout and overlays only move between frames, so
+        // culling is re-evaluated once per frame on the GUI thread
+        if (data.window) {
+            m_frameConnection = connect(data.window, &QQuickWindow::afterAnimating,
+                                        this, &GaugeCluster::updateCulling);
+        }
+        updateCulling();
+    }
+}
+
+void GaugeCluster::registerGauge(GaugeClusterAttached *gauge)
+{
+    gauge->m_phase = std::fmod(m_phaseCounter++ * kPhaseStep, 1.0);
+    gauge->m_pending = false;
+    gauge->m_lastWrite = -1;
+    gauge->m_writes = 0;
+    m_gauges.append(gauge);
+    emit gaugeCountChanged();
+    emit gauge->targetUpdateRateChanged();
+
+    if (!m_statistics.isActive()) {
+        m_statisticsStart = m_clock.elapsed();
+        m_statistics.start();
+    }
+
+    updateCulling();
+    sourceChanged(gauge);
+}
+
+void GaugeCluster::unregisterGauge(GaugeClusterAttached *gauge)
+{
+    if (!m_gauges.removeOne(gauge))
+        return;
+
+    if (gauge->m_culled) {
+        --m_culledCount;
+        emit culledCountChanged();
+    }
+    emit gaugeCountChanged();
+
+    if (m_gauges.isEmpty())
+        m_statistics.stop();
+    scheduleNext();
+}
+
+qreal GaugeCluster::rateFor(const GaugeClusterAttached *gauge) const
+{
+    if (gauge->m_updateRate >= 0.0)
+        return gauge->m_updateRate;
+    return m_rates[qBound<int>(High, gauge->m_priority, Low)];
+}
+
+qint64 GaugeCluster::nextSlot(const GaugeClusterAttached *gauge, qint64 now) const
+{
+    // Slots for a gauge are phase + k * period; the phase spreads gauges
+    // with the same rate across the period (and so across frames)
+    const qreal period = 1000.0 / rateFor(gauge);
+    const qreal phase = gauge->m_phase * period;
+    qreal due = phase + qCeil((now - phase) / period) * period;
+
+    // Never write twice in one slot
+    if (gauge->m_lastWrite >= 0 && due < gauge->m_lastWrite + period * 0.5)
+        due += period;
+    return qint64(qCeil(due));
+}
+
+void GaugeCluster::sourceChanged(GaugeClusterAttached *gauge)
+{
+    // Culled gauges only remember that they are stale
+    if (gauge->m_culled) {
+        gauge->m_pending = true;
+        return;
+    }
+
+    const qint64 now = m_clock.elapsed();
+    if (rateFor(gauge) <= 0.0) {
+        writeGauge(gauge, now);
+        return;
+    }
+
+    // Already waiting for its slot; the newest source is written then
+    if (gauge->m_pending)
+        return;
+
+    gauge->m_pending = true;
+    gauge->m_nextDue = nextSlot(gauge, now);
+    if (gauge->m_nextDue <= now)
+        writeGauge(gauge, now);
+    else
+        scheduleNext();
+}
+
+void GaugeCluster::rateChanged(GaugeClusterAttached *gauge)
+{
+    if (!gauge->m_pending || gauge->m_culled)
+        return;
+
+    const qint64 now = m_clock.elapsed();
+    if (rateFor(gauge) <= 0.0) {
+        writeGauge(gauge, now);
+        return;
+    }
+
+    gauge->m_nextDue = nextSlot(gauge, now);
+    scheduleNext();
+}
+
+void GaugeCluster::writeGauge(GaugeClusterAttached *gauge, qint64 now)
+{
+    gauge->m_pending = false;
+    gauge->m_lastWrite = now;
+    ++gauge->m_writes;
+    gauge->write();
+}
+
+void GaugeCluster::runScheduler()
+{
+    const qint64 now = m_clock.elapsed();
+
+    // Writes may destroy gauges (e.g. a Loader reacting to a value)
+    const QList<GaugeClusterAttached *> gauges = m_gauges;
+    for (GaugeClusterAttached *gauge : gauges) {
+        if (!m_gauges.contains(gauge))
+            continue;
+        if (gauge->m_pending && !gauge->m_culled && gauge->m_nextDue <= now)
+            writeGauge(gauge, now);
+    }
+
+    scheduleNext();
+}
+
+void GaugeCluster::scheduleNext()
+{
+    qint64 next = -1;
+    for (const GaugeClusterAttached *gauge : std::as_const(m_gauges)) {
+        if (gauge->m_pending && !gauge->m_culled && (next < 0 || gauge->m_nextDue < next))
+            next = gauge->m_nextDue;
+    }
+
+    if (next < 0) {
+        m_scheduler.stop();
+        return;
+    }
+    m_scheduler.start(int(qMax<qint64>(0, next - m_clock.elapsed())));
+}
+
+bool GaugeCluster::computeCulled(QQuickItem *item) const
+{
+    if (!item->isVisible())
+        return true;
+
+    qreal opacity = item->opacity();
+    QRectF visibleRect = item->mapRectToScene(item->boundingRect());
+    for (QQuickItem *ancestor = item->parentItem(); ancestor; ancestor = ancestor->parentItem()) {
+        opacity *= ancestor->opacity();
+        if (ancestor->clip())
+            visibleRect &= ancestor->mapRectToScene(ancestor->boundingRect());
+    }
+    if (opacity <= 0.0)
+        return true;
+
+    if (QQuickWindow *win = item->window())
+        visibleRect &= QRectF(QPointF(0, 0), win->size());
+    if (visibleRect.isEmpty())
+        return true;
+
+    // Fully covered by an opaque, visible occluder
+    for (QQuickItem *occluder : m_occluders) {
+        if (!occluder || occluder == item || !occluder->isVisible() || occluder->opacity() < 1.0)
+            continue;
+        if (occluder->mapRectToScene(occluder->boundingRect()).contains(visibleRect))
+            return true;
+    }
+
+    return false;
+}
+
+void GaugeCluster::updateCulling()
+{
+    const int previousCount = m_culledCount;
+    const qint64 now = m_clock.elapsed();
+
+    const QList<GaugeClusterAttached *> gauges = m_gauges;
+    for (GaugeClusterAttached *gauge : gauges) {
+        if (!m_gauges.contains(gauge))
+            continue;
+
+        QQuickItem *item = gauge->item();
+        const bool culled = m_culling && item && computeCulled(item);
+        if (culled == gauge->m_culled)
+            continue;
+
+        gauge->m_culled = culled;
+        m_culledCount += culled ? 1 : -1;
+        emit gauge->culledChanged();
+
+        // Catch up with the newest value as soon as the gauge reappears
+        if (!culled && gauge->m_pending)
+            writeGauge(gauge, now);
+    }
+
+    if (m_culledCount != previousCount) {
+        emit culledCountChanged();
+        scheduleNext();
+    }
+}
+
+void GaugeCluster::updateStatistics()
+{
+    const qint64 now = m_clock.elapsed();
+    const qreal elapsed = qMax<qint64>(1, now - m_statisticsStart);
+    m_statisticsStart = now;
+
+    for (GaugeClusterAttached *gauge : std::as_const(m_gauges)) {
+        const qreal rate = qRound(gauge->m_writes * 10000.0 / elapsed) / 10.0;
+        gauge->m_writes = 0;
+        if (!qFuzzyCompare(gauge->m_effectiveRate + 1.0, rate + 1.0)) {
+            gauge->m_effectiveRate = rate;
+            emit gauge->effectiveUpdateRateChanged();
+        }
+    }
+}
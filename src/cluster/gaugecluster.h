@@ -0,0 +1,260 @@
+#ifndef GAUGECLUSTER_H
+#define GAUGECLUSTER_H
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QMetaProperty>
+#include <QPointer>
+#include <QQmlListProperty>
+#include <QQuickItem>
+#include <QTimer>
+#include <QVariantList>
+#include <QtQml/qqmlregistration.h>
+
+class GaugeCluster;
+
+/**
+ * @brief Per-gauge scheduling state, exposed as the GaugeCluster attached property.
+ *
+ * Bind a gauge's data to GaugeCluster.source instead of its value. The
+ * enclosing GaugeCluster decides when the value is actually written:
+ * immediately, throttled to the gauge's update rate, or not at all while
+ * the gauge is culled.
+ *
+ * Outside a GaugeCluster the source is written straight through.
+ */
+class GaugeClusterAttached : public QObject
+{
+    Q_OBJECT
+    QML_ANONYMOUS
+    Q_PROPERTY(qreal source READ source WRITE setSource NOTIFY sourceChanged)
+    Q_PROPERTY(QString targetProperty READ targetProperty WRITE setTargetProperty NOTIFY targetPropertyChanged)
+    Q_PROPERTY(int priority READ priority WRITE setPriority NOTIFY priorityChanged)
+    Q_PROPERTY(qreal updateRate READ updateRate WRITE setUpdateRate NOTIFY updateRateChanged)
+    Q_PROPERTY(qreal targetUpdateRate READ targetUpdateRate NOTIFY targetUpdateRateChanged)
+    Q_PROPERTY(qreal effectiveUpdateRate READ effectiveUpdateRate NOTIFY effectiveUpdateRateChanged)
+    Q_PROPERTY(bool culled READ isCulled NOTIFY culledChanged)
+
+public:
+    explicit GaugeClusterAttached(QObject *parent);
+    ~GaugeClusterAttached() override;
+
+    /**
+     * @brief Incoming value for the gauge.
+     */
+    qreal source() const { return m_source; }
+    void setSource(qreal source);
+
+    /**
+     * @brief Gauge property the source is written to.
+     * @default "value"
+     */
+    QString targetProperty() const { return m_targetProperty; }
+    void setTargetProperty(const QString &name);
+
+    /**
+     * @brief GaugeCluster.High, GaugeCluster.Normal or GaugeCluster.Low.
+     * @default GaugeCluster.Normal
+     */
+    int priority() const { return m_priority; }
+    void setPriority(int priority);
+
+    /**
+     * @brief Maximum writes per second; overrides the priority's rate.
+     * 0 = unthrottled, -1 = use the cluster rate for the priority.
+     * @default -1
+     */
+    qreal updateRate() const { return m_updateRate; }
+    void setUpdateRate(qreal rate);
+
+    /**
+     * @brief Rate the scheduler throttles to (0 = unthrottled).
+     */
+    qreal targetUpdateRate() const;
+
+    /**
+     * @brief Measured writes per second over the last statistics window.
+     */
+    qreal effectiveUpdateRate() const { return m_effectiveRate; }
+
+    /**
+     * @brief True while the gauge is hidden, clipped away or fully occluded.
+     */
+    bool isCulled() const { return m_culled; }
+
+signals:
+    void sourceChanged();
+    void targetPropertyChanged();
+    void priorityChanged();
+    void updateRateChanged();
+    void targetUpdateRateChanged();
+    void effectiveUpdateRateChanged();
+    void culledChanged();
+
+private:
+    friend class GaugeCluster;
+
+    QQuickItem *item() const;
+    void resolveCluster();
+    void write();
+
+    qreal m_source = 0.0;
+    QString m_targetProperty = QStringLiteral("value");
+    int m_priority = 1;
+    qreal m_updateRate = -1.0;
+    QMetaProperty m_target;
+    QPointer<GaugeCluster> m_cluster;
+    bool m_clusterResolved = false;
+
+    // Scheduler state, owned by the cluster
+    bool m_pending = false;
+    bool m_culled = false;
+    qreal m_phase = 0.0;
+    qint64 m_nextDue = 0;
+    qint64 m_lastWrite = -1;
+    int m_writes = 0;
+    qreal m_effectiveRate = 0.0;
+};
+
+/**
+ * @brief Container that schedules value updates for the gauges inside it.
+ *
+ * - Culling: gauges that are invisible, outside the window or a clipping
+ *   ancestor, or fully covered by one of the occluders receive no value
+ *   writes (and so start no animations). The latest value is written when
+ *   the gauge becomes visible again.
+ * - Throttling: each gauge writes at most at its update rate. Rates come
+ *   from the gauge's priority (highUpdateRate, normalUpdateRate,
+ *   lowUpdateRate) or an explicit GaugeCluster.updateRate.
+ * - Staggering: throttled gauges get evenly spread phases within their
+ *   period, so twelve 10 Hz gauges write on different frames instead of
+ *   all on one tick.
+ * - Reporting: per-gauge effective rates via GaugeCluster.effectiveUpdateRate
+ *   and updateRates().
+ *
+ * The scheduler uses a single precise timer that only runs while a
+ * throttled update is pending.
+ *
+ * @example
+ * @code
+ * GaugeCluster {
+ *     anchors.fill: parent
+ *     occluders: [cameraOverlay]
+ *
+ *     RadialGauge { GaugeCluster.source: ecu.rpm; GaugeCluster.priority: GaugeCluster.High }
+ *     RadialGauge { GaugeCluster.source: ecu.fuel; GaugeCluster.priority: GaugeCluster.Low }
+ * }
+ * @endcode
+ */
+class GaugeCluster : public QQuickItem
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_ATTACHED(GaugeClusterAttached)
+    Q_PROPERTY(qreal highUpdateRate READ highUpdateRate WRITE setHighUpdateRate NOTIFY ratesChanged)
+    Q_PROPERTY(qreal normalUpdateRate READ normalUpdateRate WRITE setNormalUpdateRate NOTIFY ratesChanged)
+    Q_PROPERTY(qreal lowUpdateRate READ lowUpdateRate WRITE setLowUpdateRate NOTIFY ratesChanged)
+    Q_PROPERTY(bool culling READ culling WRITE setCulling NOTIFY cullingChanged)
+    Q_PROPERTY(QQmlListProperty<QQuickItem> occluders READ occluders)
+    Q_PROPERTY(int gaugeCount READ gaugeCount NOTIFY gaugeCountChanged)
+    Q_PROPERTY(int culledCount READ culledCount NOTIFY culledCountChanged)
+
+public:
+    enum Priority {
+        High,
+        Normal,
+        Low
+    };
+    Q_ENUM(Priority)
+
+    explicit GaugeCluster(QQuickItem *parent = nullptr);
+    ~GaugeCluster() override;
+
+    /**
+     * @brief Update rate for High priority gauges in Hz (0 = unthrottled).
+     * @default 0
+     */
+    qreal highUpdateRate() const { return m_rates[High]; }
+    void setHighUpdateRate(qreal rate);
+
+    /**
+     * @brief Update rate for Normal priority gauges in Hz (0 = unthrottled).
+     * @default 0
+     */
+    qreal normalUpdateRate() const { return m_rates[Normal]; }
+    void setNormalUpdateRate(qreal rate);
+
+    /**
+     * @brief Update rate for Low priority gauges in Hz (0 = unthrottled).
+     * @default 10
+     */
+    qreal lowUpdateRate() const { return m_rates[Low]; }
+    void setLowUpdateRate(qreal rate);
+
+    /**
+     * @brief Skip updates for hidden, clipped and occluded gauges.
+     * @default true
+     */
+    bool culling() const { return m_culling; }
+    void setCulling(bool enabled);
+
+    /**
+     * @brief Items (overlays, popups, camera feeds) that hide gauges they fully cover.
+     */
+    QQmlListProperty<QQuickItem> occluders();
+
+    int gaugeCount() const { return int(m_gauges.size()); }
+    int culledCount() const { return m_culledCount; }
+
+    /**
+     * @brief Per-gauge report: [{gauge, priority, targetRate, effectiveRate, culled}].
+     */
+    Q_INVOKABLE QVariantList updateRates() const;
+
+    /**
+     * @brief Re-evaluate culling now instead of on the next frame.
+     */
+    Q_INVOKABLE void updateCulling();
+
+    static GaugeClusterAttached *qmlAttachedProperties(QObject *object);
+
+signals:
+    void ratesChanged();
+    void cullingChanged();
+    void gaugeCountChanged();
+    void culledCountChanged();
+
+protected:
+    void itemChange(ItemChange change, const ItemChangeData &data) override;
+
+private:
+    friend class GaugeClusterAttached;
+
+    void registerGauge(GaugeClusterAttached *gauge);
+    void unregisterGauge(GaugeClusterAttached *gauge);
+    void sourceChanged(GaugeClusterAttached *gauge);
+    void rateChanged(GaugeClusterAttached *gauge);
+    qreal rateFor(const GaugeClusterAttached *gauge) const;
+    qint64 nextSlot(const GaugeClusterAttached *gauge, qint64 now) const;
+    bool computeCulled(QQuickItem *item) const;
+    void writeGauge(GaugeClusterAttached *gauge, qint64 now);
+    void runScheduler();
+    void scheduleNext();
+    void updateStatistics();
+    void setRate(Priority priority, qreal rate);
+
+    qreal m_rates[3] = {0.0, 0.0, 10.0};
+    bool m_culling = true;
+    QList<QQuickItem *> m_occluders;
+    QList<GaugeClusterAttached *> m_gauges;
+    int m_culledCount = 0;
+    int m_phaseCounter = 0;
+
+    QElapsedTimer m_clock;
+    QTimer m_scheduler;
+    QTimer m_statistics;
+    qint64 m_statisticsStart = 0;
+    QMetaObject::Connection m_frameConnection;
+};
+
+#endif // GAUGECLUSTER_H
@@ -1,4 +1,5 @@
 import QtQuick
+import DevDash.Gauges.Primitives 1.0
 
 /**
  * @brief Digital numeric readout with unit label.
@@ -11,6 +12,10 @@ import QtQuick
  * - Unit labels (RPM, mph, °F, etc.)
  * - Color changes based on thresholds
  * - Smooth font scaling
+ * - Tabular digits from a glyph atlas (NumericReadout), so high-rate
+ *   updates neither allocate nor re-shape text. The software renderer
+ *   cannot draw its material, so there (and whenever RasterCache is
+ *   enabled) the value is a plain Text
  *
  * @example
  * @code
@@ -46,6 +51,12 @@ Item {
      */
     property int precision: 0
 
+    /**
+     * @brief Integer digits the value keeps room for, so it does not shift.
+     * @default 1
+     */
+    property int integerDigits: 1
+
     /**
      * @brief Threshold where color changes to warning.
      * @default Infinity (never warns)
@@ -104,6 +115,37 @@ Item {
      */
     property color criticalColor: "#ff4444"
 
+    // === Alert Properties ===
+
+    /**
+     * @brief Alert level selecting the color: 0 normal, 1 warning, 2 critical.
+     *
+     * Compares value with the thresholds by default. Bind a GaugeAlert's
+     * level instead to add hysteresis and dwell time.
+     *
+     * @default level of value against the thresholds
+     */
+    property int alertLevel: value >= criticalThreshold ? 2 : value >= warningThreshold ? 1 : 0
+
+    /**
+     * @brief Lit phase of a flashing alert; the readout dims while false.
+     *
+     * Bind to a GaugeAlert's flashOn to flash in phase with other gauges.
+     *
+     * @default true
+     */
+    property bool flashOn: true
+
+    /**
+     * @brief Animate color changes.
+     *
+     * Turn off while the colors are driven by an external clock, such as a
+     * GaugeThemes transition.
+     *
+     * @default true
+     */
+    property bool colorAnimated: true
+
     // === Internal State ===
 
     /**
@@ -111,31 +153,64 @@ Item {
      * @internal
      */
     readonly property color currentColor: {
-        if (value >= criticalThreshold) return criticalColor
-        if (value >= warningThreshold) return warningColor
+        if (alertLevel >= 2) return criticalColor
+        if (alertLevel >= 1) return warningColor
         return normalColor
     }
 
-    /**
-     * @brief Formatted value string.
-     * @internal
-     */
-    readonly property string formattedValue: value.toFixed(precision)
-
     // === Implementation ===
 
     implicitWidth: 150
     implicitHeight: 70
 
+    /**
+     * @brief True when the value is drawn as Text instead of a NumericReadout.
+     * @internal
+     */
+    readonly property bool _raster: RasterCache.enabled || RasterCache.softwareBackend
+
     Column {
         anchors.centerIn: parent
         spacing: 4
+        opacity: root.flashOn ? 1.0 : 0.25
 
-        // Value text
-        Text {
+        // Value: a glyph atlas on GPU backends, Text on the raster path
+        Loader {
             id: valueText
             anchors.horizontalCenter: parent.horizontalCenter
-            text: root.formattedValue
+            sourceComponent: root._raster ? valueTextComponent : valueAtlasComponent
+        }
+
+        // Unit label
+        Text {
+            id: unitText
+            anchors.horizontalCenter: parent.horizontalCenter
+            visible: root.unit !== ""
+            text: root.unit
+            font.family: root.fontFamily
+            font.pixelSize: root.unitFontSize
+            font.weight: Font.Normal
+            color: root.currentColor
+            opacity: 0.8
+
+            // Smooth color transitions
+            Behavior on color {
+                enabled: root.colorAnimated
+                ColorAnimation {
+                    duration: 200
+                }
+            }
+        }
+    }
+
+    // Formatted without allocating and drawn from a glyph atlas
+    Component {
+        id: valueAtlasComponent
+
+        NumericReadout {
+            value: root.value
+            precision: root.precision
+            integerDigits: root.integerDigits
             font.family: root.fontFamily
             font.pixelSize: root.valueFontSize
             font.weight: root.fontWeight
@@ -143,26 +218,28 @@ Item {
 
             // Smooth color transitions
             Behavior on color {
+                enabled: root.colorAnimated
                 ColorAnimation {
                     duration: 200
                 }
             }
         }
+    }
+
+    // The software renderer only draws rectangle, image and text nodes
+    Component {
+        id: valueTextComponent
 
-        // Unit label
         Text {
-            id: unitText
-            anchors.horizontalCenter: parent.horizontalCenter
-            visible: root.unit !== ""
-            text: root.unit
+            text: root.value.toFixed(root.precision)
             font.family: root.fontFamily
-            font.pixelSize: root.unitFontSize
-            font.weight: Font.Normal
+            font.pixelSize: root.valueFontSize
+            font.weight: root.fontWeight
             color: root.currentColor
-            opacity: 0.8
 
             // Smooth color transitions
             Behavior on color {
+                enabled: root.colorAnimated
                 ColorAnimation {
                     duration: 200
                 }
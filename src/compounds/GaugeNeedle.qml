@@ -421,6 +421,21 @@ Item {
      */
     property real epsilon: 0.25
 
+    /**
+     * @brief Smallest angle change, in degrees, that moves a resting needle.
+     *
+     * Smaller changes would only restart the spring for sub-pixel motion,
+     * rendering frames nobody can see.
+     *
+     * @default half a pixel at the needle tip
+     */
+    property real settleThreshold: 0.5 / Math.max(1, totalLength) * 180 / Math.PI
+
+    /**
+     * @brief False while the needle is moving.
+     */
+    readonly property bool settled: !needleAnimation.running
+
     // === Internal Animated Property ===
     // Behavior with binding doesn't work - Behaviors only intercept imperative assignments
     // Use explicit SpringAnimation triggered by onAngleChanged
@@ -428,10 +443,15 @@ Item {
 
     onAngleChanged: {
         if (root.animated) {
+            if (!needleAnimation.running
+                    && Math.abs(root.angle - needleAnimation.to) < root.settleThreshold) {
+                return
+            }
             needleAnimation.to = root.angle
             needleAnimation.restart()
         } else {
             needleAnimation.stop()
+            needleAnimation.to = root.angle
             _displayAngle = root.angle
         }
     }
@@ -440,6 +460,7 @@ Item {
         if (!root.animated) {
             // Stop any running animation and snap to current angle
             needleAnimation.stop()
+            needleAnimation.to = root.angle
             _displayAngle = root.angle
         }
     }
@@ -454,6 +475,11 @@ Item {
         epsilon: root.epsilon
     }
 
+    FrameSource {
+        active: needleAnimation.running
+        reason: "needle settling"
+    }
+
     // === Advanced ===
 
     /**
@@ -116,12 +116,41 @@ Item {
      */
     property bool animated: true
 
+    /**
+     * @brief Animate alert color changes (requires animated).
+     * @default true
+     */
+    property bool colorAnimated: true
+
     /**
      * @brief Animation velocity in degrees per second.
      * @default 360 (one full rotation per second)
      */
     property real animationVelocity: 360
 
+    /**
+     * @brief Sweep resolution in degrees: half a pixel along the arc.
+     * @default 0.5 px at radius
+     */
+    property real settleStep: radius > 0 ? 0.5 / radius * 180 / Math.PI : 0
+
+    /**
+     * @brief False while the arc is animating towards the value.
+     */
+    readonly property bool settled: arc.settled
+
+    // === Alert Properties ===
+
+    /**
+     * @brief Alert level selecting the color: 0 normal, 1 warning, 2 critical.
+     *
+     * Compares value with the thresholds by default. Bind a GaugeAlert's
+     * level instead to add hysteresis and dwell time.
+     *
+     * @default level of value against the thresholds
+     */
+    property int alertLevel: value >= criticalThreshold ? 2 : value >= warningThreshold ? 1 : 0
+
     // === Internal State ===
 
     /**
@@ -131,7 +160,11 @@ Item {
     readonly property real valueSweepAngle: {
         const normalized = (value - minValue) / (maxValue - minValue)
         const clamped = Math.max(0, Math.min(1, normalized))
-        return totalSweepAngle * clamped
+        // Snapped to half-pixel steps at the arc: changes the eye cannot
+        // see neither start the sweep animation nor render a frame
+        const step = root.settleStep
+        const sweep = totalSweepAngle * clamped
+        return step > 0 ? Math.min(totalSweepAngle, Math.round(sweep / step) * step) : sweep
     }
 
     /**
@@ -139,8 +172,8 @@ Item {
      * @internal
      */
     readonly property color currentColor: {
-        if (value >= criticalThreshold) return criticalColor
-        if (value >= warningThreshold) return warningColor
+        if (alertLevel >= 2) return criticalColor
+        if (alertLevel >= 1) return warningColor
         return normalColor
     }
 
@@ -166,5 +199,6 @@ Item {
 
         // Animation
         animated: root.animated
+        colorAnimated: root.colorAnimated
     }
 }
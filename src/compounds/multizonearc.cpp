@@ -0,0 +1,399 @@
+#include "multizonearc.h"
+
+#include <QConicalGradient>
+#include <QPainter>
+#include <QPainterPath>
+#include <QQuickWindow>
+#include <QSGGeometryNode>
+#include <QSGImageNode>
+#include <QSGRendererInterface>
+#include <QSGVertexColorMaterial>
+#include <QtMath>
+
+#include <cmath>
+
+namespace {
+
+// Outer fringe, outer edge, inner edge, inner fringe
+constexpr int kVerticesPerColumn = 4;
+// Three quads between two columns: outer fringe, body, inner fringe
+constexpr int kIndicesPerStep = 18;
+constexpr int kMaxSegmentsPerBand = 128;
+constexpr int kMaxVertices = 65535;  // UnsignedShortType indices
+constexpr qreal kFlatness = 0.25;    // max chord deviation in pixels
+
+struct PremultipliedColor {
+    uchar r, g, b, a;
+};
+
+PremultipliedColor premultiplied(const QColor &color, qreal opacity)
+{
+    const QColor rgb = color.toRgb();
+    const qreal alpha = rgb.alphaF() * opacity;
+    return {uchar(qRound(rgb.red() * alpha)), uchar(qRound(rgb.green() * alpha)),
+            uchar(qRound(rgb.blue() * alpha)), uchar(qRound(alpha * 255))};
+}
+
+QColor mix(const QColor &from, const QColor &to, qreal t)
+{
+    const QColor a = from.toRgb();
+    const QColor b = to.toRgb();
+    return QColor::fromRgbF(a.redF() + (b.redF() - a.redF()) * t,
+                            a.greenF() + (b.greenF() - a.greenF()) * t,
+                            a.blueF() + (b.blueF() - a.blueF()) * t,
+                            a.alphaF() + (b.alphaF() - a.alphaF()) * t);
+}
+
+// Colors arrive from QML as QColor or as strings like "#ff4444"
+QColor toColor(const QVariant &value)
+{
+    if (value.metaType() == QMetaType::fromType<QColor>())
+        return value.value<QColor>();
+    return QColor::fromString(value.toString());
+}
+
+} // namespace
+
+MultiZoneArc::MultiZoneArc(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+    setFlag(ItemHasContents, true);
+    setImplicitSize(400, 400);
+}
+
+// === Properties ===
+
+void MultiZoneArc::setBands(const QVariantList &bands)
+{
+    if (m_bandList == bands)
+        return;
+
+    m_bandList = bands;
+    m_bands.clear();
+    m_bands.reserve(bands.size());
+    for (const QVariant &entry : bands) {
+        const QVariantMap map = entry.toMap();
+        bool fromOk = false;
+        bool toOk = false;
+        Band band;
+        band.from = map.value(QStringLiteral("from")).toReal(&fromOk);
+        band.to = map.value(QStringLiteral("to")).toReal(&toOk);
+        band.color = toColor(map.value(QStringLiteral("color")));
+        if (map.contains(QStringLiteral("endColor")))
+            band.endColor = toColor(map.value(QStringLiteral("endColor")));
+        if (!fromOk || !toOk || !band.color.isValid())
+            continue;
+        if (band.from > band.to)
+            std::swap(band.from, band.to);
+        m_bands.push_back(band);
+    }
+
+    invalidate();
+    emit bandsChanged();
+}
+
+void MultiZoneArc::setMinValue(qreal value)
+{
+    if (qFuzzyCompare(m_minValue, value))
+        return;
+
+    m_minValue = value;
+    invalidate();
+    emit minValueChanged();
+}
+
+void MultiZoneArc::setMaxValue(qreal value)
+{
+    if (qFuzzyCompare(m_maxValue, value))
+        return;
+
+    m_maxValue = value;
+    invalidate();
+    emit maxValueChanged();
+}
+
+void MultiZoneArc::setGaugeStartAngle(qreal angle)
+{
+    if (qFuzzyCompare(m_startAngle, angle))
+        return;
+
+    m_startAngle = angle;
+    invalidate();
+    emit gaugeStartAngleChanged();
+}
+
+void MultiZoneArc::setGaugeTotalSweep(qreal sweep)
+{
+    if (qFuzzyCompare(m_totalSweep, sweep))
+        return;
+
+    m_totalSweep = sweep;
+    invalidate();
+    emit gaugeTotalSweepChanged();
+}
+
+qreal MultiZoneArc::radius() const
+{
+    if (m_radius >= 0)
+        return m_radius;
+    return qMax(0.0, qMin(width(), height()) / 2 - m_strokeWidth / 2);
+}
+
+void MultiZoneArc::setRadius(qreal radius)
+{
+    radius = qMax(0.0, radius);
+    if (m_radius >= 0 && qFuzzyCompare(m_radius, radius))
+        return;
+
+    m_radius = radius;
+    invalidate();
+    emit radiusChanged();
+}
+
+void MultiZoneArc::resetRadius()
+{
+    if (m_radius < 0)
+        return;
+
+    m_radius = -1.0;
+    invalidate();
+    emit radiusChanged();
+}
+
+void MultiZoneArc::setStrokeWidth(qreal width)
+{
+    width = qMax(0.0, width);
+    if (qFuzzyCompare(m_strokeWidth, width))
+        return;
+
+    m_strokeWidth = width;
+    invalidate();
+    emit strokeWidthChanged();
+    if (m_radius < 0)
+        emit radiusChanged();
+}
+
+void MultiZoneArc::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size()) {
+        invalidate();
+        if (m_radius < 0)
+            emit radiusChanged();
+    }
+}
+
+void MultiZoneArc::invalidate()
+{
+    m_geometryDirty = true;
+    update();
+}
+
+// === Scene graph ===
+
+QSGNode *MultiZoneArc::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data)
+{
+    Q_UNUSED(data)
+
+    const qreal range = m_maxValue - m_minValue;
+    const qreal r = radius();
+    if (m_bands.empty() || width() <= 0 || height() <= 0 || r <= 0
+        || m_strokeWidth <= 0 || qFuzzyIsNull(range)) {
+        delete oldNode;
+        m_geometryDirty = true;
+        return nullptr;
+    }
+
+    if (window()->rendererInterface()->graphicsApi() == QSGRendererInterface::Software)
+        return updateImageNode(oldNode, range, r);
+
+    auto *node = static_cast<QSGGeometryNode *>(oldNode);
+    if (!node) {
+        node = new QSGGeometryNode;
+        node->setMaterial(new QSGVertexColorMaterial);
+        node->setFlag(QSGNode::OwnsMaterial);
+        node->setGeometry(new QSGGeometry(QSGGeometry::defaultAttributes_ColoredPoint2D(), 0, 0,
+                                          QSGGeometry::UnsignedShortType));
+        node->setFlag(QSGNode::OwnsGeometry);
+        m_geometryDirty = true;
+    }
+
+    // Only band, range and geometry changes get here with a dirty flag;
+    // anything else leaves the uploaded vertices alone
+    if (!m_geometryDirty)
+        return node;
+    m_geometryDirty = false;
+
+    // One device pixel of antialiasing fringe on each edge
+    const qreal fringe = 1.0 / (window() ? window()->effectiveDevicePixelRatio() : 1.0);
+    const qreal half = m_strokeWidth / 2;
+    const qreal radii[kVerticesPerColumn] = {
+        r + half + fringe / 2, r + half - fringe / 2,
+        r - half + fringe / 2, qMax(0.0, r - half - fringe / 2)
+    };
+
+    // Segment angle keeping chords within kFlatness of the outer edge
+    const qreal outer = radii[0];
+    const qreal step = outer > kFlatness ? 2 * std::acos(1 - kFlatness / outer) : M_PI / 2;
+
+    struct Span {
+        qreal a0, a1;  // radians
+        int segments;
+        const Band *band;
+    };
+    std::vector<Span> spans;
+    spans.reserve(m_bands.size());
+    int vertexCount = 0;
+    int indexCount = 0;
+    for (const Band &band : m_bands) {
+        const qreal from = qBound(0.0, (band.from - m_minValue) / range, 1.0);
+        const qreal to = qBound(0.0, (band.to - m_minValue) / range, 1.0);
+        if (qFuzzyCompare(from, to))
+            continue;
+
+        const qreal a0 = qDegreesToRadians(m_startAngle + m_totalSweep * qMin(from, to));
+        const qreal a1 = qDegreesToRadians(m_startAngle + m_totalSweep * qMax(from, to));
+        const int segments = qBound(1, int(std::ceil(std::abs(a1 - a0) / step)), kMaxSegmentsPerBand);
+        const int columns = segments + 1;
+        if (vertexCount + columns * kVerticesPerColumn > kMaxVertices)
+            break;
+
+        spans.push_back({a0, a1, segments, &band});
+        vertexCount += columns * kVerticesPerColumn;
+        indexCount += segments * kIndicesPerStep;
+    }
+
+    QSGGeometry *geometry = node->geometry();
+    geometry->allocate(vertexCount, indexCount);
+    geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+
+    const qreal cx = width() / 2;
+    const qreal cy = height() / 2;
+    QSGGeometry::ColoredPoint2D *vertex = geometry->vertexDataAsColoredPoint2D();
+    quint16 *index = geometry->indexDataAsUShort();
+    quint16 base = 0;
+    for (const Span &span : spans) {
+        const Band &band = *span.band;
+        const bool gradient = band.endColor.isValid();
+
+        for (int column = 0; column <= span.segments; ++column) {
+            const qreal t = qreal(column) / span.segments;
+            const qreal angle = span.a0 + (span.a1 - span.a0) * t;
+            const qreal cosA = std::cos(angle);
+            const qreal sinA = std::sin(angle);
+            const PremultipliedColor body = premultiplied(gradient ? mix(band.color, band.endColor, t)
+                                                                   : band.color, 1.0);
+            for (int ring = 0; ring < kVerticesPerColumn; ++ring) {
+                const bool edge = ring == 0 || ring == kVerticesPerColumn - 1;
+                const uchar alpha = edge ? 0 : body.a;
+                vertex->set(float(cx + radii[ring] * cosA), float(cy + radii[ring] * sinA),
+                            edge ? 0 : body.r, edge ? 0 : body.g, edge ? 0 : body.b, alpha);
+                ++vertex;
+            }
+        }
+
+        // Three quads between consecutive columns
+        for (int segment = 0; segment < span.segments; ++segment) {
+            const quint16 c0 = quint16(base + segment * kVerticesPerColumn);
+            const quint16 c1 = quint16(c0 + kVerticesPerColumn);
+            for (int ring = 0; ring < kVerticesPerColumn - 1; ++ring) {
+                index[0] = c0 + ring;
+                index[1] = c0 + ring + 1;
+                index[2] = c1 + ring;
+                index[3] = c1 + ring;
+                index[4] = c0 + ring + 1;
+                index[5] = c1 + ring + 1;
+                index += 6;
+            }
+        }
+        base = quint16(base + (span.segments + 1) * kVerticesPerColumn);
+    }
+
+    geometry->markVertexDataDirty();
+    geometry->markIndexDataDirty();
+    node->markDirty(QSGNode::DirtyGeometry);
+
+    reportTessellation();
+    return node;
+}
+
+// The software renderer skips custom geometry, so paint the bands instead
+QSGNode *MultiZoneArc::updateImageNode(QSGNode *oldNode, qreal range, qreal radius)
+{
+    QQuickWindow *win = window();
+    auto *node = static_cast<QSGImageNode *>(oldNode);
+    if (!node) {
+        node = win->createImageNode();
+        node->setOwnsTexture(true);
+        node->setFiltering(QSGTexture::Linear);
+        m_geometryDirty = true;
+    }
+
+    node->setRect(boundingRect());
+    if (!m_geometryDirty)
+        return node;
+    m_geometryDirty = false;
+
+    const qreal dpr = win->effectiveDevicePixelRatio();
+    QImage image(QSize(qCeil(width() * dpr), qCeil(height() * dpr)),
+                 QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(dpr);
+    image.fill(Qt::transparent);
+
+    const QPointF center(width() / 2, height() / 2);
+    const qreal half = m_strokeWidth / 2;
+    const QRectF outer(center.x() - radius - half, center.y() - radius - half,
+                       2 * (radius + half), 2 * (radius + half));
+    const qreal innerRadius = qMax(0.0, radius - half);
+    const QRectF inner(center.x() - innerRadius, center.y() - innerRadius,
+                       2 * innerRadius, 2 * innerRadius);
+
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(Qt::NoPen);
+    for (const Band &band : m_bands) {
+        const qreal from = qBound(0.0, (band.from - m_minValue) / range, 1.0);
+        const qreal to = qBound(0.0, (band.to - m_minValue) / range, 1.0);
+        if (qFuzzyCompare(from, to))
+            continue;
+
+        // Item angles run clockwise on screen; QPainter's run counter-clockwise
+        const qreal a0 = m_startAngle + m_totalSweep * qMin(from, to);
+        const qreal a1 = m_startAngle + m_totalSweep * qMax(from, to);
+        const qreal sweep = qMin(a1 - a0, 360.0);
+
+        QPainterPath path;
+        path.arcMoveTo(outer, -a0);
+        path.arcTo(outer, -a0, -sweep);
+        path.arcTo(inner, -a0 - sweep, sweep);
+        path.closeSubpath();
+
+        if (band.endColor.isValid()) {
+            // The conical gradient starts at the band's end and turns
+            // counter-clockwise back to its start
+            QConicalGradient gradient(center, -a0 - sweep);
+            gradient.setColorAt(0.0, band.endColor);
+            gradient.setColorAt(sweep / 360.0, band.color);
+            painter.setBrush(gradient);
+        } else {
+            painter.setBrush(band.color);
+        }
+        painter.drawPath(path);
+    }
+    painter.end();
+
+    // The node owns its texture and releases the previous one
+    node->setTexture(win->createTextureFromImage(image));
+    reportTessellation();
+    return node;
+}
+
+void MultiZoneArc::reportTessellation()
+{
+    // Runs on the render thread; report back on the GUI thread
+    const int count = ++m_syncedTessellations;
+    QMetaObject::invokeMethod(this, [this, count]() {
+        m_tessellationCount = count;
+        emit tessellationCountChanged();
+    }, Qt::QueuedConnection);
+}
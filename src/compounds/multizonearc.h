@@ -0,0 +1,164 @@
+#ifndef MULTIZONEARC_H
+#define MULTIZONEARC_H
+
+#include <QColor>
+#include <QQuickItem>
+#include <QVariantList>
+#include <QtQml/qqmlregistration.h>
+
+#include <vector>
+
+/**
+ * @brief Any number of colored zones on a gauge arc, in one geometry node.
+ *
+ * Each entry of bands covers a value range of the gauge and is drawn with
+ * a solid color, or as a gradient when endColor is given:
+ *
+ *   { from: 60, to: 90, color: "#2266ff", endColor: "#22cc66" }
+ *
+ * Values are mapped through minValue/maxValue onto gaugeStartAngle and
+ * gaugeTotalSweep, like GaugeZoneArc. Where GaugeZoneArc is one Shape per
+ * zone, all bands here are tessellated into one vertex-colored ring strip:
+ * a single draw call however many bands there are. Gradients are
+ * interpolated per vertex; band edges get a one-pixel antialiasing fringe.
+ *
+ * Tessellation runs only when bands, the value range, angles, radius,
+ * stroke width or size change - never for opacity, position or a value on
+ * the gauge. tessellationCount counts the rebuilds.
+ *
+ * The software renderer cannot draw vertex-colored geometry. On that
+ * backend the bands are painted with QPainter into one image node instead,
+ * repainted under the same conditions and counted the same way.
+ *
+ * @example
+ * @code
+ * MultiZoneArc {
+ *     anchors.fill: parent
+ *     minValue: 40
+ *     maxValue: 130
+ *     bands: [
+ *         { from: 40,  to: 60,  color: "#2266ff" },
+ *         { from: 60,  to: 75,  color: "#2266ff", endColor: "#22cc66" },
+ *         { from: 75,  to: 105, color: "#22cc66" },
+ *         { from: 105, to: 115, color: "#22cc66", endColor: "#ffaa00" },
+ *         { from: 115, to: 130, color: "#ff4444" }
+ *     ]
+ * }
+ * @endcode
+ */
+class MultiZoneArc : public QQuickItem
+{
+    Q_OBJECT
+    QML_ELEMENT
+    Q_PROPERTY(QVariantList bands READ bands WRITE setBands NOTIFY bandsChanged)
+    Q_PROPERTY(qreal minValue READ minValue WRITE setMinValue NOTIFY minValueChanged)
+    Q_PROPERTY(qreal maxValue READ maxValue WRITE setMaxValue NOTIFY maxValueChanged)
+    Q_PROPERTY(qreal gaugeStartAngle READ gaugeStartAngle WRITE setGaugeStartAngle NOTIFY gaugeStartAngleChanged)
+    Q_PROPERTY(qreal gaugeTotalSweep READ gaugeTotalSweep WRITE setGaugeTotalSweep NOTIFY gaugeTotalSweepChanged)
+    Q_PROPERTY(qreal radius READ radius WRITE setRadius RESET resetRadius NOTIFY radiusChanged)
+    Q_PROPERTY(qreal strokeWidth READ strokeWidth WRITE setStrokeWidth NOTIFY strokeWidthChanged)
+    Q_PROPERTY(int bandCount READ bandCount NOTIFY bandsChanged)
+    Q_PROPERTY(int tessellationCount READ tessellationCount NOTIFY tessellationCountChanged)
+
+public:
+    explicit MultiZoneArc(QQuickItem *parent = nullptr);
+
+    /**
+     * @brief Zones as {from, to, color[, endColor]}; entries without a
+     * valid range are ignored.
+     * @default []
+     */
+    QVariantList bands() const { return m_bandList; }
+    void setBands(const QVariantList &bands);
+
+    /**
+     * @brief Value at gaugeStartAngle.
+     * @default 0
+     */
+    qreal minValue() const { return m_minValue; }
+    void setMinValue(qreal value);
+
+    /**
+     * @brief Value at the end of gaugeTotalSweep.
+     * @default 100
+     */
+    qreal maxValue() const { return m_maxValue; }
+    void setMaxValue(qreal value);
+
+    /**
+     * @brief Starting angle of the gauge in degrees (0 = 3 o'clock).
+     * @default -225
+     */
+    qreal gaugeStartAngle() const { return m_startAngle; }
+    void setGaugeStartAngle(qreal angle);
+
+    /**
+     * @brief Total sweep angle of the gauge in degrees.
+     * @default 270
+     */
+    qreal gaugeTotalSweep() const { return m_totalSweep; }
+    void setGaugeTotalSweep(qreal sweep);
+
+    /**
+     * @brief Radius of the arc's center line in pixels.
+     * @default Auto-calculated to fit within bounds
+     */
+    qreal radius() const;
+    void setRadius(qreal radius);
+    void resetRadius();
+
+    /**
+     * @brief Width of the arc stroke in pixels.
+     * @default 20
+     */
+    qreal strokeWidth() const { return m_strokeWidth; }
+    void setStrokeWidth(qreal width);
+
+    int bandCount() const { return int(m_bands.size()); }
+
+    /**
+     * @brief Number of times the geometry was rebuilt.
+     */
+    int tessellationCount() const { return m_tessellationCount; }
+
+signals:
+    void bandsChanged();
+    void minValueChanged();
+    void maxValueChanged();
+    void gaugeStartAngleChanged();
+    void gaugeTotalSweepChanged();
+    void radiusChanged();
+    void strokeWidthChanged();
+    void tessellationCountChanged();
+
+protected:
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) override;
+
+private:
+    struct Band {
+        qreal from = 0.0;
+        qreal to = 0.0;
+        QColor color;
+        QColor endColor;
+    };
+
+    void invalidate();
+    QSGNode *updateImageNode(QSGNode *oldNode, qreal range, qreal radius);
+    void reportTessellation();
+
+    QVariantList m_bandList;
+    std::vector<Band> m_bands;
+    qreal m_minValue = 0.0;
+    qreal m_maxValue = 100.0;
+    qreal m_startAngle = -225.0;
+    qreal m_totalSweep = 270.0;
+    qreal m_radius = -1.0;  // negative: fit the item
+    qreal m_strokeWidth = 20.0;
+
+    bool m_geometryDirty = true;
+    int m_tessellationCount = 0;
+    int m_syncedTessellations = 0;
+};
+
+#endif // MULTIZONEARC_H
@@ -0,0 +1,569 @@
+#include "numericreadout.h"
+
+#include <QFontMetricsF>
+#include <QPainter>
+#include <QQuickWindow>
+#include <QSGGeometryNode>
+#include <QSGMaterial>
+#include <QSGMaterialShader>
+#include <QSGTexture>
+#include <QtMath>
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <memory>
+
+namespace {
+
+constexpr int kVerticesPerQuad = 4;
+constexpr int kIndicesPerQuad = 6;
+constexpr int kMaxPrecision = 6;
+constexpr qreal kGlyphPadding = 1.0;  // keeps antialiased edges off the cell border
+
+// Atlas coverage tinted with the text color (shaders/numericreadout.*)
+class ReadoutMaterial : public QSGMaterial
+{
+public:
+    ReadoutMaterial() { setFlag(Blending); }
+
+    QSGMaterialType *type() const override
+    {
+        static QSGMaterialType type;
+        return &type;
+    }
+
+    QSGMaterialShader *createShader(QSGRendererInterface::RenderMode) const override;
+
+    int compare(const QSGMaterial *other) const override
+    {
+        const auto *material = static_cast<const ReadoutMaterial *>(other);
+        const qint64 key = texture ? texture->comparisonKey() : 0;
+        const qint64 otherKey = material->texture ? material->texture->comparisonKey() : 0;
+        if (key != otherKey)
+            return key < otherKey ? -1 : 1;
+        const QRgb rgba = color.rgba();
+        const QRgb otherRgba = material->color.rgba();
+        return rgba == otherRgba ? 0 : (rgba < otherRgba ? -1 : 1);
+    }
+
+    QSGTexture *texture = nullptr;
+    QColor color = Qt::white;
+};
+
+class ReadoutShader : public QSGMaterialShader
+{
+public:
+    ReadoutShader()
+    {
+        setShaderFileName(VertexStage,
+                          QStringLiteral(":/DevDash/Gauges/Compounds/shaders/numericreadout.vert.qsb"));
+        setShaderFileName(FragmentStage,
+                          QStringLiteral(":/DevDash/Gauges/Compounds/shaders/numericreadout.frag.qsb"));
+    }
+
+    bool updateUniformData(RenderState &state, QSGMaterial *newMaterial,
+                           QSGMaterial *oldMaterial) override
+    {
+        // std140: mat4 matrix at 0, vec4 color at 64
+        QByteArray *buffer = state.uniformData();
+        bool changed = false;
+        if (state.isMatrixDirty()) {
+            const QMatrix4x4 matrix = state.combinedMatrix();
+            std::memcpy(buffer->data(), matrix.constData(), 64);
+            changed = true;
+        }
+
+        const auto *material = static_cast<ReadoutMaterial *>(newMaterial);
+        const auto *previous = static_cast<ReadoutMaterial *>(oldMaterial);
+        if (!previous || previous->color != material->color || state.isOpacityDirty()) {
+            const QColor rgb = material->color.toRgb();
+            const float alpha = float(rgb.alphaF()) * state.opacity();
+            const float color[4] = {float(rgb.redF()) * alpha, float(rgb.greenF()) * alpha,
+                                    float(rgb.blueF()) * alpha, alpha};
+            std::memcpy(buffer->data() + 64, color, sizeof(color));
+            changed = true;
+        }
+        return changed;
+    }
+
+    void updateSampledImage(RenderState &state, int binding, QSGTexture **texture,
+                            QSGMaterial *newMaterial, QSGMaterial *oldMaterial) override
+    {
+        Q_UNUSED(oldMaterial)
+        if (binding != 1)
+            return;
+
+        auto *material = static_cast<ReadoutMaterial *>(newMaterial);
+        if (material->texture)
+            material->texture->commitTextureOperations(state.rhi(), state.resourceUpdateBatch());
+        *texture = material->texture;
+    }
+};
+
+QSGMaterialShader *ReadoutMaterial::createShader(QSGRendererInterface::RenderMode) const
+{
+    return new ReadoutShader;
+}
+
+// Geometry node that owns its atlas texture
+class ReadoutNode : public QSGGeometryNode
+{
+public:
+    ReadoutNode()
+    {
+        setMaterial(&m_material);
+    }
+
+    void setTexture(QSGTexture *texture)
+    {
+        m_texture.reset(texture);
+        m_texture->setFiltering(QSGTexture::Linear);
+        m_material.texture = texture;
+        markDirty(QSGNode::DirtyMaterial);
+    }
+
+    void setColor(const QColor &color)
+    {
+        if (m_material.color == color)
+            return;
+        m_material.color = color;
+        markDirty(QSGNode::DirtyMaterial);
+    }
+
+private:
+    ReadoutMaterial m_material;
+    std::unique_ptr<QSGTexture> m_texture;
+};
+
+} // namespace
+
+NumericReadout::NumericReadout(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+    setFlag(ItemHasContents, true);
+    format();
+}
+
+// === Properties ===
+
+void NumericReadout::setValue(qreal value)
+{
+    if (qFuzzyCompare(m_value, value))
+        return;
+
+    m_value = value;
+    emit valueChanged();
+
+    // Same text, same quads: no frame
+    if (format())
+        update();
+}
+
+void NumericReadout::setPrecision(int precision)
+{
+    precision = qBound(0, precision, kMaxPrecision);
+    if (m_precision == precision)
+        return;
+
+    m_precision = precision;
+    format();
+    updateImplicitSize();
+    update();
+    emit precisionChanged();
+}
+
+void NumericReadout::setIntegerDigits(int digits)
+{
+    digits = qBound(1, digits, kMaxChars - kMaxPrecision - 2);
+    if (m_integerDigits == digits)
+        return;
+
+    m_integerDigits = digits;
+    updateImplicitSize();
+    update();
+    emit integerDigitsChanged();
+}
+
+void NumericReadout::setTabular(bool tabular)
+{
+    if (m_tabular == tabular)
+        return;
+
+    m_tabular = tabular;
+    updateImplicitSize();
+    update();
+    emit tabularChanged();
+}
+
+void NumericReadout::setFont(const QFont &font)
+{
+    if (m_font == font)
+        return;
+
+    m_font = font;
+    invalidateAtlas();
+    emit fontChanged();
+}
+
+void NumericReadout::setColor(const QColor &color)
+{
+    if (m_color == color)
+        return;
+
+    // A tint: no re-bake and no quads rewritten
+    m_color = color;
+    m_colorDirty = true;
+    update();
+    emit colorChanged();
+}
+
+void NumericReadout::setUnit(const QString &unit)
+{
+    if (m_unit == unit)
+        return;
+
+    m_unit = unit;
+    invalidateAtlas();
+    emit unitChanged();
+}
+
+void NumericReadout::setUnitScale(qreal scale)
+{
+    scale = qMax(0.1, scale);
+    if (qFuzzyCompare(m_unitScale, scale))
+        return;
+
+    m_unitScale = scale;
+    if (!m_unit.isEmpty())
+        invalidateAtlas();
+    emit unitScaleChanged();
+}
+
+void NumericReadout::setHorizontalAlignment(Qt::Alignment alignment)
+{
+    alignment &= Qt::AlignHorizontal_Mask;
+    if (m_alignment == alignment)
+        return;
+
+    m_alignment = alignment;
+    update();
+    emit horizontalAlignmentChanged();
+}
+
+void NumericReadout::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size()) {
+        m_quadsDirty = true;
+        update();
+    }
+}
+
+void NumericReadout::itemChange(ItemChange change, const ItemChangeData &data)
+{
+    QQuickItem::itemChange(change, data);
+    if (change == ItemSceneChange || change == ItemDevicePixelRatioHasChanged)
+        invalidateAtlas();
+}
+
+// === Formatting ===
+
+bool NumericReadout::format()
+{
+    std::array<char, kMaxChars> text;
+    char *begin = text.data();
+    int length = 0;
+
+    const auto result = std::isfinite(m_value)
+        ? std::to_chars(begin, begin + kMaxChars, double(m_value), std::chars_format::fixed, m_precision)
+        : std::to_chars_result{begin, std::errc::value_too_large};
+    if (result.ec == std::errc()) {
+        length = int(result.ptr - begin);
+    } else {
+        // Out of range: dashes in place of the integer digits
+        length = m_integerDigits;
+        std::memset(begin, '-', size_t(length));
+    }
+
+    if (length == m_length && std::memcmp(begin, m_text.data(), size_t(length)) == 0)
+        return false;
+
+    std::memcpy(m_text.data(), begin, size_t(length));
+    m_length = length;
+    return true;
+}
+
+// === Atlas ===
+
+void NumericReadout::invalidateAtlas()
+{
+    m_atlasDirty = true;
+    polish();
+}
+
+void NumericReadout::updatePolish()
+{
+    QQuickWindow *win = window();
+    if (!m_atlasDirty || !win)
+        return;
+    m_atlasDirty = false;
+
+    QFont unitFont = m_font;
+    if (m_font.pixelSize() > 0)
+        unitFont.setPixelSize(qMax(1, qRound(m_font.pixelSize() * m_unitScale)));
+    else
+        unitFont.setPointSizeF(m_font.pointSizeF() * m_unitScale);
+
+    const QFontMetricsF metrics(m_font);
+    const QFontMetricsF unitMetrics(unitFont);
+    static constexpr char kCharacters[] = "0123456789-.";
+
+    // One cell per glyph, side by side
+    qreal atlasWidth = 0;
+    m_digitAdvance = 0;
+    for (int i = 0; i < GlyphUnit; ++i) {
+        Glyph &glyph = m_glyphs[i];
+        glyph.advance = metrics.horizontalAdvance(QLatin1Char(kCharacters[i]));
+        glyph.size = QSizeF(glyph.advance + 2 * kGlyphPadding, metrics.height() + 2 * kGlyphPadding);
+        glyph.ascent = metrics.ascent() + kGlyphPadding;
+        glyph.source = QRectF(atlasWidth, 0, glyph.size.width(), glyph.size.height());
+        atlasWidth += qCeil(glyph.size.width());
+        if (i <= 9)
+            m_digitAdvance = qMax(m_digitAdvance, glyph.advance);
+    }
+
+    Glyph &unit = m_glyphs[GlyphUnit];
+    unit.advance = m_unit.isEmpty() ? 0 : unitMetrics.horizontalAdvance(m_unit);
+    unit.size = QSizeF(unit.advance + 2 * kGlyphPadding, unitMetrics.height() + 2 * kGlyphPadding);
+    unit.ascent = unitMetrics.ascent() + kGlyphPadding;
+    unit.source = QRectF(atlasWidth, 0, unit.size.width(), unit.size.height());
+    atlasWidth += qCeil(unit.size.width());
+
+    m_unitGap = unitMetrics.horizontalAdvance(QLatin1Char(' '));
+    m_lineAscent = metrics.ascent();
+    m_lineHeight = metrics.height();
+
+    // Bake at the window's pixel ratio so glyphs map 1:1 to pixels
+    const qreal ratio = win->effectiveDevicePixelRatio();
+    const QSizeF logicalSize(atlasWidth, qMax(m_glyphs[0].size.height(), unit.size.height()));
+    m_atlas = QImage((logicalSize * ratio).toSize().expandedTo(QSize(1, 1)),
+                     QImage::Format_ARGB32_Premultiplied);
+    m_atlas.setDevicePixelRatio(ratio);
+    m_atlas.fill(Qt::transparent);
+    m_atlasRatio = ratio;
+    {
+        QPainter painter(&m_atlas);
+        painter.setRenderHint(QPainter::TextAntialiasing);
+        // Coverage only; the material applies the color
+        painter.setPen(Qt::white);
+        painter.setFont(m_font);
+        for (int i = 0; i < GlyphUnit; ++i) {
+            const Glyph &glyph = m_glyphs[i];
+            painter.drawText(QPointF(glyph.source.x() + kGlyphPadding, glyph.ascent),
+                             QString(QLatin1Char(kCharacters[i])));
+        }
+        if (!m_unit.isEmpty()) {
+            painter.setFont(unitFont);
+            painter.drawText(QPointF(unit.source.x() + kGlyphPadding, unit.ascent), m_unit);
+        }
+    }
+
+    // Texture coordinates are normalized to the atlas
+    for (Glyph &glyph : m_glyphs) {
+        glyph.source = QRectF(glyph.source.x() / logicalSize.width(), glyph.source.y() / logicalSize.height(),
+                              glyph.source.width() / logicalSize.width(), glyph.source.height() / logicalSize.height());
+    }
+
+    m_textureDirty = true;
+    m_quadsDirty = true;
+    ++m_atlasBakeCount;
+    emit atlasBakeCountChanged();
+    updateImplicitSize();
+    update();
+}
+
+void NumericReadout::updateImplicitSize()
+{
+    if (m_lineHeight <= 0)
+        return;
+
+    qreal width = m_integerDigits * m_digitAdvance;
+    if (m_precision > 0)
+        width += m_glyphs[GlyphPoint].advance + m_precision * m_digitAdvance;
+    if (!m_unit.isEmpty())
+        width += m_unitGap + m_glyphs[GlyphUnit].advance;
+
+    setImplicitSize(width, m_lineHeight);
+}
+
+// === Scene graph ===
+
+void NumericReadout::layout(std::array<Quad, kQuadCount> &quads) const
+{
+    auto glyphFor = [](char c) {
+        if (c >= '0' && c <= '9')
+            return c - '0';
+        if (c == '-')
+            return int(GlyphMinus);
+        if (c == '.')
+            return int(GlyphPoint);
+        return int(GlyphNone);
+    };
+    auto advanceOf = [this](int glyph) {
+        return m_tabular && glyph <= 9 ? m_digitAdvance : m_glyphs[glyph].advance;
+    };
+
+    qreal numberWidth = 0;
+    for (int i = 0; i < m_length; ++i) {
+        const int glyph = glyphFor(m_text[i]);
+        if (glyph != GlyphNone)
+            numberWidth += advanceOf(glyph);
+    }
+
+    // Tabular numbers are right-aligned in a field of at least integerDigits,
+    // so the point and unit do not move as digits come and go
+    qreal fieldWidth = numberWidth;
+    if (m_tabular) {
+        qreal reserved = m_integerDigits * m_digitAdvance;
+        if (m_precision > 0)
+            reserved += m_glyphs[GlyphPoint].advance + m_precision * m_digitAdvance;
+        fieldWidth = qMax(fieldWidth, reserved);
+    }
+    const bool hasUnit = !m_unit.isEmpty();
+    const qreal total = fieldWidth + (hasUnit ? m_unitGap + m_glyphs[GlyphUnit].advance : 0);
+
+    qreal x = 0;
+    if (m_alignment & Qt::AlignRight)
+        x = width() - total;
+    else if (m_alignment & Qt::AlignHCenter)
+        x = (width() - total) / 2;
+
+    auto snap = [this](qreal value) {
+        return float(qRound(value * m_atlasRatio) / m_atlasRatio);
+    };
+
+    qreal pen = x + fieldWidth - numberWidth;
+    int quad = 0;
+    for (int i = 0; i < m_length && quad < kMaxChars; ++i) {
+        const int glyph = glyphFor(m_text[i]);
+        if (glyph == GlyphNone)
+            continue;
+        const qreal advance = advanceOf(glyph);
+        const qreal centering = (advance - m_glyphs[glyph].advance) / 2;
+        quads[quad++] = Quad { glyph, snap(pen + centering - kGlyphPadding) };
+        pen += advance;
+    }
+    for (; quad < kMaxChars; ++quad)
+        quads[quad] = Quad();
+
+    quads[kMaxChars] = hasUnit
+        ? Quad { GlyphUnit, snap(x + fieldWidth + m_unitGap - kGlyphPadding) }
+        : Quad();
+}
+
+void NumericReadout::writeQuad(QSGGeometry::TexturedPoint2D *vertices, const Quad &quad) const
+{
+    if (quad.glyph == GlyphNone) {
+        // Degenerate: nothing rasterized
+        for (int i = 0; i < kVerticesPerQuad; ++i)
+            vertices[i].set(0, 0, 0, 0);
+        return;
+    }
+
+    const Glyph &glyph = m_glyphs[quad.glyph];
+    const qreal baseline = (height() - m_lineHeight) / 2 + m_lineAscent;
+    const float top = float(qRound((baseline - glyph.ascent) * m_atlasRatio) / m_atlasRatio);
+    const float left = quad.x;
+    const float right = left + float(glyph.size.width());
+    const float bottom = top + float(glyph.size.height());
+    const QRectF &uv = glyph.source;
+
+    vertices[0].set(left, top, float(uv.left()), float(uv.top()));
+    vertices[1].set(left, bottom, float(uv.left()), float(uv.bottom()));
+    vertices[2].set(right, top, float(uv.right()), float(uv.top()));
+    vertices[3].set(right, bottom, float(uv.right()), float(uv.bottom()));
+}
+
+QSGNode *NumericReadout::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data)
+{
+    Q_UNUSED(data)
+
+    if (m_atlas.isNull() || width() <= 0 || height() <= 0) {
+        delete oldNode;
+        m_quadsDirty = true;
+        m_textureDirty = true;
+        m_colorDirty = true;
+        return nullptr;
+    }
+
+    auto *node = static_cast<ReadoutNode *>(oldNode);
+    if (!node) {
+        node = new ReadoutNode;
+
+        auto *geometry = new QSGGeometry(QSGGeometry::defaultAttributes_TexturedPoint2D(),
+                                         kQuadCount * kVerticesPerQuad, kQuadCount * kIndicesPerQuad,
+                                         QSGGeometry::UnsignedShortType);
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        geometry->setVertexDataPattern(QSGGeometry::DynamicPattern);
+        geometry->setIndexDataPattern(QSGGeometry::StaticPattern);
+
+        quint16 *indices = geometry->indexDataAsUShort();
+        for (int quad = 0; quad < kQuadCount; ++quad) {
+            const quint16 base = quint16(quad * kVerticesPerQuad);
+            quint16 *out = indices + quad * kIndicesPerQuad;
+            out[0] = base;
+            out[1] = base + 1;
+            out[2] = base + 2;
+            out[3] = base + 2;
+            out[4] = base + 1;
+            out[5] = base + 3;
+        }
+
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+        m_quadsDirty = true;
+        m_textureDirty = true;
+        m_colorDirty = true;
+    }
+
+    if (m_textureDirty) {
+        node->setTexture(window()->createTextureFromImage(m_atlas));
+        m_textureDirty = false;
+    }
+    if (m_colorDirty) {
+        node->setColor(m_color);
+        m_colorDirty = false;
+    }
+
+    std::array<Quad, kQuadCount> quads;
+    layout(quads);
+
+    QSGGeometry *geometry = node->geometry();
+    QSGGeometry::TexturedPoint2D *vertices = geometry->vertexDataAsTexturedPoint2D();
+    int updated = 0;
+    for (int i = 0; i < kQuadCount; ++i) {
+        if (!m_quadsDirty && quads[i] == m_quads[i])
+            continue;
+        writeQuad(vertices + i * kVerticesPerQuad, quads[i]);
+        m_quads[i] = quads[i];
+        ++updated;
+    }
+    m_quadsDirty = false;
+
+    if (updated > 0) {
+        geometry->markVertexDataDirty();
+        node->markDirty(QSGNode::DirtyGeometry);
+    }
+
+    // Runs on the render thread; report back on the GUI thread
+    if (updated != m_syncedGlyphs) {
+        m_syncedGlyphs = updated;
+        QMetaObject::invokeMethod(this, [this, updated]() {
+            m_lastUpdatedGlyphs = updated;
+            emit lastUpdatedGlyphsChanged();
+        }, Qt::QueuedConnection);
+    }
+
+    return node;
+}
@@ -0,0 +1,221 @@
+#ifndef NUMERICREADOUT_H
+#define NUMERICREADOUT_H
+
+#include <QColor>
+#include <QFont>
+#include <QImage>
+#include <QQuickItem>
+#include <QSGGeometry>
+#include <QtQml/qqmlregistration.h>
+
+#include <array>
+
+/**
+ * @brief Numeric text drawn from a pre-baked glyph atlas.
+ *
+ * A drop-in for a Text showing value.toFixed(precision) that does no work
+ * per update beyond formatting and moving quads:
+ *
+ * - value is formatted with std::to_chars into a fixed buffer; no strings
+ *   are allocated and nothing is shaped
+ * - the digits, sign, decimal point and unit are rasterized once per font,
+ *   unit and device pixel ratio into a small coverage atlas; color is a
+ *   material tint, so color animations re-bake and re-upload nothing
+ * - all characters are quads of one QSGGeometryNode; an update rewrites
+ *   only the quads whose character or position changed, and does not
+ *   schedule a frame when the formatted text is unchanged
+ *
+ * With tabular (the default) every digit takes the width of the widest
+ * digit and the number is laid out from the right, so the decimal point
+ * and the unit stay put while the value changes. integerDigits reserves
+ * room for that many digits in the implicit width.
+ *
+ * The unit is drawn after the number at unitScale of the font size,
+ * sharing its baseline.
+ *
+ * @example
+ * @code
+ * NumericReadout {
+ *     value: ecu.rpm
+ *     integerDigits: 4
+ *     unit: "RPM"
+ *     font.pixelSize: 48
+ *     color: "white"
+ * }
+ * @endcode
+ */
+class NumericReadout : public QQuickItem
+{
+    Q_OBJECT
+    QML_ELEMENT
+    Q_PROPERTY(qreal value READ value WRITE setValue NOTIFY valueChanged)
+    Q_PROPERTY(int precision READ precision WRITE setPrecision NOTIFY precisionChanged)
+    Q_PROPERTY(int integerDigits READ integerDigits WRITE setIntegerDigits NOTIFY integerDigitsChanged)
+    Q_PROPERTY(bool tabular READ isTabular WRITE setTabular NOTIFY tabularChanged)
+    Q_PROPERTY(QFont font READ font WRITE setFont NOTIFY fontChanged)
+    Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY colorChanged)
+    Q_PROPERTY(QString unit READ unit WRITE setUnit NOTIFY unitChanged)
+    Q_PROPERTY(qreal unitScale READ unitScale WRITE setUnitScale NOTIFY unitScaleChanged)
+    Q_PROPERTY(Qt::Alignment horizontalAlignment READ horizontalAlignment WRITE setHorizontalAlignment NOTIFY horizontalAlignmentChanged)
+    Q_PROPERTY(int lastUpdatedGlyphs READ lastUpdatedGlyphs NOTIFY lastUpdatedGlyphsChanged)
+    Q_PROPERTY(int atlasBakeCount READ atlasBakeCount NOTIFY atlasBakeCountChanged)
+
+public:
+    explicit NumericReadout(QQuickItem *parent = nullptr);
+
+    qreal value() const { return m_value; }
+    void setValue(qreal value);
+
+    /**
+     * @brief Digits after the decimal point (0-6).
+     * @default 0
+     */
+    int precision() const { return m_precision; }
+    void setPrecision(int precision);
+
+    /**
+     * @brief Integer digits the implicit width reserves room for.
+     * @default 1
+     */
+    int integerDigits() const { return m_integerDigits; }
+    void setIntegerDigits(int digits);
+
+    /**
+     * @brief Fixed-width digits laid out from the right.
+     * @default true
+     */
+    bool isTabular() const { return m_tabular; }
+    void setTabular(bool tabular);
+
+    QFont font() const { return m_font; }
+    void setFont(const QFont &font);
+
+    /**
+     * @brief Text color, applied as a tint of the atlas.
+     * @default "white"
+     */
+    QColor color() const { return m_color; }
+    void setColor(const QColor &color);
+
+    /**
+     * @brief Unit drawn after the number, e.g. "RPM".
+     * @default ""
+     */
+    QString unit() const { return m_unit; }
+    void setUnit(const QString &unit);
+
+    /**
+     * @brief Unit font size relative to font.
+     * @default 0.5
+     */
+    qreal unitScale() const { return m_unitScale; }
+    void setUnitScale(qreal scale);
+
+    /**
+     * @brief Qt.AlignLeft, Qt.AlignHCenter or Qt.AlignRight.
+     * @default Qt.AlignHCenter
+     */
+    Qt::Alignment horizontalAlignment() const { return m_alignment; }
+    void setHorizontalAlignment(Qt::Alignment alignment);
+
+    /**
+     * @brief Quads rewritten by the last scene graph sync.
+     */
+    int lastUpdatedGlyphs() const { return m_lastUpdatedGlyphs; }
+
+    /**
+     * @brief Number of times the glyph atlas was rasterized.
+     */
+    int atlasBakeCount() const { return m_atlasBakeCount; }
+
+signals:
+    void valueChanged();
+    void precisionChanged();
+    void integerDigitsChanged();
+    void tabularChanged();
+    void fontChanged();
+    void colorChanged();
+    void unitChanged();
+    void unitScaleChanged();
+    void horizontalAlignmentChanged();
+    void lastUpdatedGlyphsChanged();
+    void atlasBakeCountChanged();
+
+protected:
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void itemChange(ItemChange change, const ItemChangeData &data) override;
+    void updatePolish() override;
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) override;
+
+private:
+    // Sign, up to 16 integer digits, point and 6 decimals, plus one unit quad
+    static constexpr int kMaxChars = 24;
+    static constexpr int kQuadCount = kMaxChars + 1;
+
+    enum GlyphIndex {
+        GlyphMinus = 10,
+        GlyphPoint = 11,
+        GlyphUnit = 12,
+        GlyphCount = 13,
+        GlyphNone = -1
+    };
+
+    struct Glyph {
+        QRectF source;   // normalized atlas rect
+        QSizeF size;     // logical size of the quad
+        qreal advance = 0.0;
+        qreal ascent = 0.0;
+    };
+
+    // What a quad shows; quads are only rewritten when this changes
+    struct Quad {
+        int glyph = GlyphNone;
+        float x = 0.0f;
+
+        bool operator==(const Quad &other) const
+        {
+            return glyph == other.glyph && x == other.x;
+        }
+    };
+
+    bool format();  // true when the text changed
+    void invalidateAtlas();
+    void updateImplicitSize();
+    void layout(std::array<Quad, kQuadCount> &quads) const;
+    void writeQuad(QSGGeometry::TexturedPoint2D *vertices, const Quad &quad) const;
+
+    qreal m_value = 0.0;
+    int m_precision = 0;
+    int m_integerDigits = 1;
+    bool m_tabular = true;
+    QFont m_font;
+    QColor m_color = Qt::white;
+    QString m_unit;
+    qreal m_unitScale = 0.5;
+    Qt::Alignment m_alignment = Qt::AlignHCenter;
+    int m_lastUpdatedGlyphs = 0;
+    int m_atlasBakeCount = 0;
+
+    // Formatted value; rewritten in place on every value change
+    std::array<char, kMaxChars> m_text {};
+    int m_length = 0;
+
+    // Atlas, baked on the GUI thread in updatePolish and uploaded on sync
+    QImage m_atlas;
+    std::array<Glyph, GlyphCount> m_glyphs {};
+    qreal m_digitAdvance = 0.0;
+    qreal m_unitGap = 0.0;
+    qreal m_lineAscent = 0.0;
+    qreal m_lineHeight = 0.0;
+    qreal m_atlasRatio = 0.0;
+    bool m_atlasDirty = true;
+    bool m_textureDirty = true;
+    bool m_colorDirty = true;
+
+    // Scene graph state. m_quadsDirty forces every quad to be rewritten.
+    std::array<Quad, kQuadCount> m_quads {};
+    bool m_quadsDirty = true;
+    int m_syncedGlyphs = 0;
+};
+
+#endif // NUMERICREADOUT_H
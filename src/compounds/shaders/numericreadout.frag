@@ -0,0 +1,20 @@
+#version 440
+
+// NumericReadout: the atlas holds coverage only; the text color is a uniform,
+// so a color change never re-bakes or re-uploads the atlas
+
+layout(location = 0) in vec2 texCoord;
+
+layout(location = 0) out vec4 fragColor;
+
+layout(std140, binding = 0) uniform buf {
+    mat4 matrix;
+    vec4 color;
+};
+
+layout(binding = 1) uniform sampler2D atlas;
+
+void main()
+{
+    fragColor = color * texture(atlas, texCoord).a;
+}
@@ -0,0 +1,21 @@
+#version 440
+
+// NumericReadout: glyph quads from the atlas
+
+layout(location = 0) in vec4 vertexCoord;
+layout(location = 1) in vec2 vertexTexCoord;
+
+layout(location = 0) out vec2 texCoord;
+
+layout(std140, binding = 0) uniform buf {
+    mat4 matrix;
+    vec4 color;  // premultiplied, item opacity applied
+};
+
+out gl_PerVertex { vec4 gl_Position; };
+
+void main()
+{
+    texCoord = vertexTexCoord;
+    gl_Position = matrix * vertexCoord;
+}
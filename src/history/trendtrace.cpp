@@ -0,0 +1,318 @@
+#include "trendtrace.h"
+
+#include "valuehistory.h"
+
+#include <QSGFlatColorMaterial>
+#include <QSGGeometryNode>
+#include <QSGTransformNode>
+#include <QtMath>
+
+#include <cstring>
+
+namespace {
+
+constexpr int kVerticesPerQuad = 4;
+constexpr int kIndicesPerQuad = 6;
+constexpr int kQuadsPerColumn = 4;         // Capacity per visible pixel column
+constexpr qint64 kMaxColumn = 1 << 22;     // Rebase before float x loses precision
+
+} // namespace
+
+TrendTrace::TrendTrace(QQuickItem *parent)
+    : QQuickItem(parent)
+    , m_color(0x00, 0xaa, 0xff)
+{
+    setFlag(ItemHasContents, true);
+    setClip(true);
+}
+
+// === Properties ===
+
+void TrendTrace::setHistory(ValueHistory *history)
+{
+    if (m_history == history)
+        return;
+
+    if (m_history)
+        disconnect(m_history, nullptr, this, nullptr);
+
+    m_history = history;
+    if (m_history) {
+        connect(m_history, &ValueHistory::appended, this, [this]() { update(); });
+        connect(m_history, &ValueHistory::cleared, this, &TrendTrace::invalidate);
+        connect(m_history, &ValueHistory::capacityChanged, this, &TrendTrace::invalidate);
+        connect(m_history, &QObject::destroyed, this, &TrendTrace::invalidate);
+    }
+
+    invalidate();
+    emit historyChanged();
+}
+
+void TrendTrace::setTimeWindow(int ms)
+{
+    ms = qMax(1, ms);
+    if (m_timeWindow == ms)
+        return;
+
+    m_timeWindow = ms;
+    invalidate();
+    emit timeWindowChanged();
+}
+
+void TrendTrace::setMinValue(qreal minValue)
+{
+    if (qFuzzyCompare(m_minValue, minValue))
+        return;
+
+    m_minValue = minValue;
+    invalidate();
+    emit minValueChanged();
+}
+
+void TrendTrace::setMaxValue(qreal maxValue)
+{
+    if (qFuzzyCompare(m_maxValue, maxValue))
+        return;
+
+    m_maxValue = maxValue;
+    invalidate();
+    emit maxValueChanged();
+}
+
+void TrendTrace::setColor(const QColor &color)
+{
+    if (m_color == color)
+        return;
+
+    m_color = color;
+    m_colorDirty = true;
+    update();
+    emit colorChanged();
+}
+
+void TrendTrace::setLineWidth(qreal width)
+{
+    width = qMax(0.0, width);
+    if (qFuzzyCompare(m_lineWidth, width))
+        return;
+
+    m_lineWidth = width;
+    invalidate();
+    emit lineWidthChanged();
+}
+
+void TrendTrace::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size())
+        invalidate();
+}
+
+void TrendTrace::invalidate()
+{
+    m_dirty = true;
+    update();
+}
+
+// === Scene graph ===
+
+QSGNode *TrendTrace::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data)
+{
+    Q_UNUSED(data)
+
+    if (!m_history || width() <= 0 || height() <= 0 || m_maxValue <= m_minValue) {
+        delete oldNode;
+        m_dirty = true;
+        return nullptr;
+    }
+
+    auto *root = static_cast<QSGTransformNode *>(oldNode);
+    QSGGeometryNode *node = nullptr;
+    if (!root) {
+        root = new QSGTransformNode;
+        node = new QSGGeometryNode;
+        node->setMaterial(new QSGFlatColorMaterial);
+        node->setFlag(QSGNode::OwnsMaterial);
+
+        auto *geometry = new QSGGeometry(QSGGeometry::defaultAttributes_Point2D(), 0, 0,
+                                         QSGGeometry::UnsignedIntType);
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        geometry->setVertexDataPattern(QSGGeometry::DynamicPattern);
+        geometry->setIndexDataPattern(QSGGeometry::StaticPattern);
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+
+        root->appendChildNode(node);
+        m_dirty = true;
+        m_colorDirty = true;
+    } else {
+        node = static_cast<QSGGeometryNode *>(root->firstChild());
+    }
+
+    if (m_colorDirty) {
+        static_cast<QSGFlatColorMaterial *>(node->material())->setColor(m_color);
+        node->markDirty(QSGNode::DirtyMaterial);
+        m_colorDirty = false;
+    }
+
+    QSGGeometry *geometry = node->geometry();
+    const qint64 sequence = m_history->sequence();
+    bool changed = false;
+
+    if (m_dirty || m_lastColumn > kMaxColumn) {
+        rebuild(geometry);
+        m_dirty = false;
+        changed = true;
+    } else if (m_drawnSequence != sequence) {
+        // Append only the samples recorded since the last sync
+        const qint64 oldest = sequence - m_history->count();
+        for (qint64 s = qMax(m_drawnSequence, oldest); s < sequence; ++s) {
+            const ValueHistory::Sample &sample = m_history->at(int(s - oldest));
+            appendSample(geometry, sample.time, sample.value);
+        }
+        m_drawnSequence = sequence;
+        changed = true;
+    }
+
+    if (changed) {
+        geometry->markVertexDataDirty();
+        node->markDirty(QSGNode::DirtyGeometry);
+    }
+
+    // Columns are pixels; the newest column ends at the right edge
+    const qreal scaleY = -height() / (m_maxValue - m_minValue);
+    const QMatrix4x4 matrix(1, 0, 0, width() - qreal(m_lastColumn + 1),
+                            0, scaleY, 0, height() - m_minValue * scaleY,
+                            0, 0, 1, 0,
+                            0, 0, 0, 1);
+    if (root->matrix() != matrix)
+        root->setMatrix(matrix);
+
+    // Runs on the render thread; report back on the GUI thread
+    if (m_slotCount != m_syncedColumns) {
+        const int columns = m_slotCount;
+        m_syncedColumns = columns;
+        QMetaObject::invokeMethod(this, [this, columns]() {
+            m_columnCount = columns;
+            emit columnCountChanged();
+        }, Qt::QueuedConnection);
+    }
+
+    return root;
+}
+
+void TrendTrace::rebuild(QSGGeometry *geometry)
+{
+    const int capacity = kQuadsPerColumn * (qCeil(width()) + 2);
+    if (geometry->vertexCount() != capacity * kVerticesPerQuad) {
+        geometry->allocate(capacity * kVerticesPerQuad, capacity * kIndicesPerQuad);
+
+        quint32 *indices = geometry->indexDataAsUInt();
+        for (int quad = 0; quad < capacity; ++quad) {
+            const quint32 base = quint32(quad * kVerticesPerQuad);
+            quint32 *out = indices + quad * kIndicesPerQuad;
+            out[0] = base;
+            out[1] = base + 1;
+            out[2] = base + 2;
+            out[3] = base + 2;
+            out[4] = base + 1;
+            out[5] = base + 3;
+        }
+        geometry->markIndexDataDirty();
+    }
+
+    // Unused slots stay zeroed: their triangles are degenerate
+    std::memset(geometry->vertexData(), 0, size_t(geometry->vertexCount()) * geometry->sizeOfVertex());
+
+    m_columnTime = qreal(m_timeWindow) / width();
+    m_halfLine = m_lineWidth / 2 * (m_maxValue - m_minValue) / height();
+    m_slotCount = 0;
+    m_columnSlot = -1;
+    m_lastColumn = -1;
+    m_hasValue = false;
+    m_drawnSequence = m_history->sequence();
+
+    const int count = m_history->count();
+    if (count == 0) {
+        m_originTime = m_history->now() - m_timeWindow;
+        return;
+    }
+
+    m_originTime = m_history->at(count - 1).time - m_timeWindow;
+    const int first = m_history->firstIndexAfter(m_originTime);
+
+    // The value entering the window from the left
+    if (first > 0) {
+        m_lastValue = m_history->at(first - 1).value;
+        m_hasValue = true;
+    }
+
+    for (int i = first; i < count; ++i)
+        appendSample(geometry, m_history->at(i).time, m_history->at(i).value);
+}
+
+void TrendTrace::appendSample(QSGGeometry *geometry, qint64 time, qreal value)
+{
+    const qint64 column = qMax(qMax<qint64>(m_lastColumn, 0),
+                               qint64(qFloor((time - m_originTime) / m_columnTime)));
+
+    // Same pixel column: widen its min/max in place
+    if (column == m_lastColumn && m_columnSlot >= 0) {
+        m_columnLow = qMin(m_columnLow, value);
+        m_columnHigh = qMax(m_columnHigh, value);
+        writeQuad(geometry, m_columnSlot, column, column + 1, m_columnLow, m_columnHigh);
+        m_lastValue = value;
+        return;
+    }
+
+    const bool gap = m_hasValue && column > m_lastColumn + 1;
+    const int capacity = geometry->vertexCount() / kVerticesPerQuad;
+    if (m_slotCount + (gap ? 2 : 1) > capacity)
+        compact(geometry);
+
+    // Hold the previous value across columns without samples
+    if (gap)
+        writeQuad(geometry, m_slotCount++, m_lastColumn + 1, column, m_lastValue, m_lastValue);
+
+    m_columnLow = m_hasValue ? qMin(m_lastValue, value) : value;
+    m_columnHigh = m_hasValue ? qMax(m_lastValue, value) : value;
+    m_columnSlot = m_slotCount++;
+    writeQuad(geometry, m_columnSlot, column, column + 1, m_columnLow, m_columnHigh);
+
+    m_lastColumn = column;
+    m_lastValue = value;
+    m_hasValue = true;
+}
+
+void TrendTrace::writeQuad(QSGGeometry *geometry, int slot, float x0, float x1,
+                           qreal low, qreal high)
+{
+    const float bottom = float(low - m_halfLine);
+    const float top = float(high + m_halfLine);
+    QSGGeometry::Point2D *vertices = geometry->vertexDataAsPoint2D() + slot * kVerticesPerQuad;
+    vertices[0].set(x0, bottom);
+    vertices[1].set(x1, bottom);
+    vertices[2].set(x0, top);
+    vertices[3].set(x1, top);
+}
+
+void TrendTrace::compact(QSGGeometry *geometry)
+{
+    // Drop quads that have scrolled out on the left and move the rest to
+    // the front; at most two quads per visible column remain
+    QSGGeometry::Point2D *vertices = geometry->vertexDataAsPoint2D();
+    const float visibleFrom = float(m_lastColumn + 1 - qCeil(width()));
+    int dropped = 0;
+    while (dropped < m_slotCount - 1 && vertices[dropped * kVerticesPerQuad + 1].x <= visibleFrom)
+        ++dropped;
+    dropped = qMax(dropped, 2);
+
+    const int kept = m_slotCount - dropped;
+    std::memmove(vertices, vertices + dropped * kVerticesPerQuad,
+                 size_t(kept) * kVerticesPerQuad * sizeof(QSGGeometry::Point2D));
+    std::memset(vertices + kept * kVerticesPerQuad, 0,
+                size_t(dropped) * kVerticesPerQuad * sizeof(QSGGeometry::Point2D));
+
+    m_slotCount = kept;
+    m_columnSlot -= dropped;
+}
@@ -0,0 +1,129 @@
+#ifndef TRENDTRACE_H
+#define TRENDTRACE_H
+
+#include <QColor>
+#include <QPointer>
+#include <QQuickItem>
+#include <QSGGeometry>
+#include <QtQml/qqmlregistration.h>
+
+class ValueHistory;
+
+/**
+ * @brief Scrolling trend line of a ValueHistory.
+ *
+ * The trace keeps one min/max column per pixel of the time window, so
+ * spikes between pixels stay visible no matter how fast the history fills.
+ * New samples are appended to the existing geometry: a sample only writes
+ * the vertices of the column it falls in, and scrolling is a transform
+ * change. The geometry is rebuilt only when the size, time window, value
+ * range or line width changes, or the history is cleared.
+ *
+ * The right edge follows the newest sample, so a history that stops
+ * changing stops the trace as well and requests no further frames.
+ *
+ * @example
+ * @code
+ * TrendTrace {
+ *     width: 300; height: 80
+ *     history: boostHistory
+ *     timeWindow: 10000
+ *     minValue: -1; maxValue: 2
+ * }
+ * @endcode
+ */
+class TrendTrace : public QQuickItem
+{
+    Q_OBJECT
+    QML_ELEMENT
+    Q_PROPERTY(ValueHistory *history READ history WRITE setHistory NOTIFY historyChanged)
+    Q_PROPERTY(int timeWindow READ timeWindow WRITE setTimeWindow NOTIFY timeWindowChanged)
+    Q_PROPERTY(qreal minValue READ minValue WRITE setMinValue NOTIFY minValueChanged)
+    Q_PROPERTY(qreal maxValue READ maxValue WRITE setMaxValue NOTIFY maxValueChanged)
+    Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY colorChanged)
+    Q_PROPERTY(qreal lineWidth READ lineWidth WRITE setLineWidth NOTIFY lineWidthChanged)
+    Q_PROPERTY(int columnCount READ columnCount NOTIFY columnCountChanged)
+
+public:
+    explicit TrendTrace(QQuickItem *parent = nullptr);
+
+    ValueHistory *history() const { return m_history; }
+    void setHistory(ValueHistory *history);
+
+    /**
+     * @brief Time span across the width of the trace, in ms.
+     * @default 10000
+     */
+    int timeWindow() const { return m_timeWindow; }
+    void setTimeWindow(int ms);
+
+    qreal minValue() const { return m_minValue; }
+    void setMinValue(qreal minValue);
+    qreal maxValue() const { return m_maxValue; }
+    void setMaxValue(qreal maxValue);
+
+    /**
+     * @default "#00aaff"
+     */
+    QColor color() const { return m_color; }
+    void setColor(const QColor &color);
+
+    /**
+     * @brief Line thickness in pixels.
+     * @default 1.5
+     */
+    qreal lineWidth() const { return m_lineWidth; }
+    void setLineWidth(qreal width);
+
+    /**
+     * @brief Quads currently held in the trace geometry (diagnostics).
+     */
+    int columnCount() const { return m_columnCount; }
+
+signals:
+    void historyChanged();
+    void timeWindowChanged();
+    void minValueChanged();
+    void maxValueChanged();
+    void colorChanged();
+    void lineWidthChanged();
+    void columnCountChanged();
+
+protected:
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) override;
+
+private:
+    void invalidate();
+    void rebuild(QSGGeometry *geometry);
+    void appendSample(QSGGeometry *geometry, qint64 time, qreal value);
+    void writeQuad(QSGGeometry *geometry, int slot, float x0, float x1, qreal low, qreal high);
+    void compact(QSGGeometry *geometry);
+
+    QPointer<ValueHistory> m_history;
+    int m_timeWindow = 10000;
+    qreal m_minValue = 0.0;
+    qreal m_maxValue = 100.0;
+    QColor m_color;
+    qreal m_lineWidth = 1.5;
+    int m_columnCount = 0;
+
+    // Scene graph state, only touched during sync. Quads are stored in
+    // slots; x is in columns (pixels) since m_originTime, y in value units.
+    bool m_dirty = true;
+    bool m_colorDirty = true;
+    int m_slotCount = 0;
+    int m_columnSlot = -1;      // Slot of the newest column, extended in place
+    qint64 m_lastColumn = -1;
+    qreal m_lastValue = 0.0;
+    qreal m_columnLow = 0.0;
+    qreal m_columnHigh = 0.0;
+    bool m_hasValue = false;
+    qint64 m_originTime = 0;
+    qreal m_columnTime = 1.0;   // ms per column
+    qreal m_halfLine = 0.0;     // Half the line width in value units
+    qint64 m_drawnSequence = 0;
+    int m_syncedColumns = 0;
+};
+
+#endif // TRENDTRACE_H
@@ -0,0 +1,328 @@
+#include "valuehistory.h"
+
+#include <QVariantMap>
+#include <QtMath>
+
+namespace {
+
+constexpr int kDefaultCapacity = 1024;
+constexpr int kMaxCapacity = 1 << 20;
+constexpr int kPeakDecayInterval = 33;  // ms, ~30 Hz while the peak is falling
+
+} // namespace
+
+ValueHistory::ValueHistory(QObject *parent)
+    : QObject(parent)
+    , m_samples(kDefaultCapacity)
+{
+    m_clock.start();
+
+    // A coarse timer may fire up to 5% early, before the hold has ended
+    m_peakTimer.setSingleShot(true);
+    m_peakTimer.setTimerType(Qt::PreciseTimer);
+    connect(&m_peakTimer, &QTimer::timeout, this, [this]() { updatePeak(now()); });
+}
+
+// === Properties ===
+
+void ValueHistory::setValue(qreal value)
+{
+    if (m_value == value)
+        return;
+
+    if (m_recording) {
+        append(value);
+        return;
+    }
+
+    m_value = value;
+    emit valueChanged();
+}
+
+void ValueHistory::setCapacity(int capacity)
+{
+    capacity = qBound(2, capacity, kMaxCapacity);
+    if (capacity == int(m_samples.size()))
+        return;
+
+    m_samples.assign(capacity, Sample {0, 0.0});
+    clear();
+    emit capacityChanged();
+}
+
+void ValueHistory::setRecording(bool recording)
+{
+    if (m_recording == recording)
+        return;
+
+    m_recording = recording;
+    emit recordingChanged();
+}
+
+void ValueHistory::setPeakHoldTime(int ms)
+{
+    ms = qMax(0, ms);
+    if (m_peakHoldTime == ms)
+        return;
+
+    m_peakHoldTime = ms;
+    emit peakHoldTimeChanged();
+}
+
+void ValueHistory::setPeakDecayRate(qreal rate)
+{
+    rate = qMax(0.0, rate);
+    if (qFuzzyCompare(m_peakDecayRate, rate))
+        return;
+
+    m_peakDecayRate = rate;
+    emit peakDecayRateChanged();
+}
+
+qreal ValueHistory::min() const
+{
+    return m_minQueue.empty() ? m_value : bySequence(m_minQueue.front()).value;
+}
+
+qreal ValueHistory::max() const
+{
+    return m_maxQueue.empty() ? m_value : bySequence(m_maxQueue.front()).value;
+}
+
+// === Samples ===
+
+const ValueHistory::Sample &ValueHistory::at(int index) const
+{
+    const int capacity = int(m_samples.size());
+    return m_samples[(m_head - m_count + index + capacity) % capacity];
+}
+
+const ValueHistory::Sample &ValueHistory::bySequence(qint64 sequence) const
+{
+    return at(int(sequence - (m_sequence - m_count)));
+}
+
+void ValueHistory::append(qreal value, qint64 time)
+{
+    if (time < 0)
+        time = now();
+
+    const int capacity = int(m_samples.size());
+    const qint64 sequence = m_sequence;
+
+    // Drop the sample about to be overwritten from the min / max queues
+    if (m_count == capacity) {
+        const qint64 evicted = sequence - capacity;
+        if (!m_minQueue.empty() && m_minQueue.front() <= evicted)
+            m_minQueue.pop_front();
+        if (!m_maxQueue.empty() && m_maxQueue.front() <= evicted)
+            m_maxQueue.pop_front();
+    } else {
+        ++m_count;
+    }
+
+    m_samples[m_head] = Sample {time, value};
+    m_head = (m_head + 1) % capacity;
+    ++m_sequence;
+
+    while (!m_minQueue.empty() && bySequence(m_minQueue.back()).value >= value)
+        m_minQueue.pop_back();
+    m_minQueue.push_back(sequence);
+    while (!m_maxQueue.empty() && bySequence(m_maxQueue.back()).value <= value)
+        m_maxQueue.pop_back();
+    m_maxQueue.push_back(sequence);
+
+    const bool changed = m_value != value;
+    m_value = value;
+    updatePeak(time);
+
+    if (changed)
+        emit valueChanged();
+    emit statisticsChanged();
+    emit appended(time, value);
+}
+
+void ValueHistory::clear()
+{
+    m_head = 0;
+    m_count = 0;
+    m_minQueue.clear();
+    m_maxQueue.clear();
+    resetPeak();
+    emit statisticsChanged();
+    emit cleared();
+}
+
+// === Peak ===
+
+void ValueHistory::resetPeak()
+{
+    m_peakTimer.stop();
+    m_heldPeak = m_value;
+    m_peakTime = now();
+    setPeak(m_value);
+}
+
+void ValueHistory::setPeak(qreal peak)
+{
+    if (m_peak == peak)
+        return;
+
+    m_peak = peak;
+    emit peakChanged();
+}
+
+void ValueHistory::updatePeak(qint64 now)
+{
+    // New maximum: hold it
+    if (m_value >= m_peak) {
+        m_heldPeak = m_value;
+        m_peakTime = now;
+        setPeak(m_value);
+        if (m_peakHoldTime > 0)
+            m_peakTimer.start(m_peakHoldTime);
+        else
+            m_peakTimer.stop();
+        return;
+    }
+
+    const qint64 decaying = now - m_peakTime - m_peakHoldTime;
+    if (decaying < 0) {
+        // Still holding; make sure the timer fires at the end of the hold,
+        // since no new sample may arrive to end it
+        m_peakTimer.start(int(-decaying));
+        return;
+    }
+
+    if (m_peakDecayRate <= 0.0) {
+        setPeak(m_value);
+        return;
+    }
+
+    setPeak(qMax(m_value, m_heldPeak - m_peakDecayRate * decaying / 1000.0));
+
+    // Keep falling even if no new samples arrive
+    if (m_peak > m_value)
+        m_peakTimer.start(kPeakDecayInterval);
+}
+
+// === Decimation ===
+
+int ValueHistory::firstIndexAfter(qint64 time) const
+{
+    int low = 0;
+    int high = m_count;
+    while (low < high) {
+        const int middle = (low + high) / 2;
+        if (at(middle).time < time)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+QVariantList ValueHistory::decimate(int buckets, DecimationMode mode, qint64 timeWindow) const
+{
+    QVariantList points;
+    if (m_count == 0 || buckets <= 0)
+        return points;
+
+    const int first = timeWindow > 0 ? firstIndexAfter(at(m_count - 1).time - timeWindow) : 0;
+    QList<QPointF> decimated;
+    if (mode == Lttb)
+        decimateLttb(first, m_count - 1, buckets, decimated);
+    else
+        decimateMinMax(first, m_count - 1, buckets, decimated);
+
+    points.reserve(decimated.size());
+    for (const QPointF &point : std::as_const(decimated))
+        points.append(QVariantMap {{QStringLiteral("x"), point.x()}, {QStringLiteral("y"), point.y()}});
+    return points;
+}
+
+void ValueHistory::decimateMinMax(int first, int last, int buckets, QList<QPointF> &out) const
+{
+    if (first > last)
+        return;
+
+    const qint64 start = at(first).time;
+    const qreal span = qMax<qint64>(1, at(last).time - start);
+    const qreal bucketWidth = span / buckets;
+
+    // Each time bucket contributes its min and max, in time order, so
+    // spikes survive any amount of decimation
+    int index = first;
+    while (index <= last) {
+        const int bucket = qMin(buckets - 1, int((at(index).time - start) / bucketWidth));
+        const Sample *low = &at(index);
+        const Sample *high = low;
+        for (++index; index <= last; ++index) {
+            const Sample &sample = at(index);
+            if (qMin(buckets - 1, int((sample.time - start) / bucketWidth)) != bucket)
+                break;
+            if (sample.value < low->value)
+                low = &sample;
+            if (sample.value > high->value)
+                high = &sample;
+        }
+
+        const Sample *earlier = low->time <= high->time ? low : high;
+        const Sample *later = earlier == low ? high : low;
+        out.append(QPointF(earlier->time, earlier->value));
+        if (later != earlier)
+            out.append(QPointF(later->time, later->value));
+    }
+}
+
+void ValueHistory::decimateLttb(int first, int last, int buckets, QList<QPointF> &out) const
+{
+    const int count = last - first + 1;
+    if (count <= 0)
+        return;
+
+    if (buckets >= count || buckets < 3) {
+        for (int i = first; i <= last; ++i)
+            out.append(QPointF(at(i).time, at(i).value));
+        return;
+    }
+
+    // Largest-Triangle-Three-Buckets (Steinarsson 2013): keep the first and
+    // last samples, and from each bucket in between the sample forming the
+    // largest triangle with the previous pick and the next bucket's average
+    const qreal bucketSize = qreal(count - 2) / (buckets - 2);
+    int picked = first;
+    out.append(QPointF(at(first).time, at(first).value));
+
+    for (int bucket = 0; bucket < buckets - 2; ++bucket) {
+        const int rangeStart = first + 1 + int(bucket * bucketSize);
+        const int rangeEnd = first + 1 + int((bucket + 1) * bucketSize);
+
+        const int nextStart = rangeEnd;
+        const int nextEnd = qMin(last + 1, first + 1 + int((bucket + 2) * bucketSize));
+        qreal averageTime = 0.0;
+        qreal averageValue = 0.0;
+        for (int i = nextStart; i < nextEnd; ++i) {
+            averageTime += at(i).time;
+            averageValue += at(i).value;
+        }
+        const int nextCount = qMax(1, nextEnd - nextStart);
+        averageTime /= nextCount;
+        averageValue /= nextCount;
+
+        const Sample &anchor = at(picked);
+        qreal largestArea = -1.0;
+        for (int i = rangeStart; i < rangeEnd; ++i) {
+            const Sample &candidate = at(i);
+            const qreal area = qAbs((anchor.time - averageTime) * (candidate.value - anchor.value)
+                                    - (anchor.time - candidate.time) * (averageValue - anchor.value));
+            if (area > largestArea) {
+                largestArea = area;
+                picked = i;
+            }
+        }
+        out.append(QPointF(at(picked).time, at(picked).value));
+    }
+
+    out.append(QPointF(at(last).time, at(last).value));
+}
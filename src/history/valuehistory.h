@@ -0,0 +1,189 @@
+#ifndef VALUEHISTORY_H
+#define VALUEHISTORY_H
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QObject>
+#include <QPointF>
+#include <QTimer>
+#include <QVariantList>
+#include <QtQml/qqmlregistration.h>
+
+#include <deque>
+#include <vector>
+
+/**
+ * @brief Fixed-capacity ring buffer of timestamped gauge samples.
+ *
+ * Records a sample every time value changes (or append() is called) and
+ * tracks, without rescanning the buffer:
+ * - min / max of all samples currently held (monotonic queues, O(1) amortized)
+ * - peak: highest recent value, held for peakHoldTime and then decaying
+ *   toward the current value at peakDecayRate
+ *
+ * Sample storage is allocated once at the configured capacity and reused
+ * as a ring. decimate() reduces the history to a pixel width with min-max
+ * or LTTB (Largest-Triangle-Three-Buckets) decimation, and TrendTrace
+ * draws it incrementally.
+ *
+ * Samples must be appended in time order. append() accepts explicit
+ * timestamps (e.g. from a data logger) on the same ms scale as now().
+ *
+ * @example
+ * @code
+ * ValueHistory {
+ *     id: boostHistory
+ *     value: ecu.boost
+ *     capacity: 2048
+ *     peakHoldTime: 3000
+ * }
+ *
+ * RadialGauge { value: ecu.boost; showPeak: true; peakValue: boostHistory.peak }
+ * TrendTrace { history: boostHistory; timeWindow: 10000 }
+ * @endcode
+ */
+class ValueHistory : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    Q_PROPERTY(qreal value READ value WRITE setValue NOTIFY valueChanged)
+    Q_PROPERTY(int capacity READ capacity WRITE setCapacity NOTIFY capacityChanged)
+    Q_PROPERTY(bool recording READ recording WRITE setRecording NOTIFY recordingChanged)
+    Q_PROPERTY(int count READ count NOTIFY statisticsChanged)
+    Q_PROPERTY(qreal min READ min NOTIFY statisticsChanged)
+    Q_PROPERTY(qreal max READ max NOTIFY statisticsChanged)
+    Q_PROPERTY(qreal peak READ peak NOTIFY peakChanged)
+    Q_PROPERTY(int peakHoldTime READ peakHoldTime WRITE setPeakHoldTime NOTIFY peakHoldTimeChanged)
+    Q_PROPERTY(qreal peakDecayRate READ peakDecayRate WRITE setPeakDecayRate NOTIFY peakDecayRateChanged)
+
+public:
+    struct Sample {
+        qint64 time;  // ms on the history clock
+        qreal value;
+    };
+
+    enum DecimationMode {
+        MinMax,
+        Lttb
+    };
+    Q_ENUM(DecimationMode)
+
+    explicit ValueHistory(QObject *parent = nullptr);
+
+    /**
+     * @brief Latest value; writing it appends a sample stamped with the current time.
+     */
+    qreal value() const { return m_value; }
+    void setValue(qreal value);
+
+    /**
+     * @brief Maximum number of samples held; the oldest are overwritten.
+     * Changing the capacity clears the history.
+     * @default 1024
+     */
+    int capacity() const { return int(m_samples.size()); }
+    void setCapacity(int capacity);
+
+    /**
+     * @brief Record value changes (false pauses the history).
+     * @default true
+     */
+    bool recording() const { return m_recording; }
+    void setRecording(bool recording);
+
+    int count() const { return m_count; }
+    qreal min() const;
+    qreal max() const;
+    qreal peak() const { return m_peak; }
+
+    /**
+     * @brief Time in ms a new peak is held before it starts to decay.
+     * @default 2000
+     */
+    int peakHoldTime() const { return m_peakHoldTime; }
+    void setPeakHoldTime(int ms);
+
+    /**
+     * @brief Peak fall rate after the hold, in value units per second.
+     * 0 drops the peak straight to the current value.
+     * @default 0
+     */
+    qreal peakDecayRate() const { return m_peakDecayRate; }
+    void setPeakDecayRate(qreal rate);
+
+    /**
+     * @brief Sample by age order: 0 is the oldest held sample.
+     */
+    const Sample &at(int index) const;
+
+    /**
+     * @brief Index of the first sample at or after time (count() if none).
+     */
+    int firstIndexAfter(qint64 time) const;
+
+    /**
+     * @brief Total samples ever appended; identifies samples across wrap-around.
+     */
+    qint64 sequence() const { return m_sequence; }
+
+    /**
+     * @brief Current time on the history clock (ms).
+     */
+    qint64 now() const { return m_clock.elapsed(); }
+
+    /**
+     * @brief Append a sample. A negative time stamps it with now().
+     */
+    Q_INVOKABLE void append(qreal value, qint64 time = -1);
+    Q_INVOKABLE void clear();
+    Q_INVOKABLE void resetPeak();
+
+    /**
+     * @brief Decimate the samples of the last timeWindow ms (0 = all) to
+     * about `buckets` points: [{x: time, y: value}, ...].
+     */
+    Q_INVOKABLE QVariantList decimate(int buckets, DecimationMode mode = MinMax,
+                                      qint64 timeWindow = 0) const;
+
+    void decimateMinMax(int first, int last, int buckets, QList<QPointF> &out) const;
+    void decimateLttb(int first, int last, int buckets, QList<QPointF> &out) const;
+
+signals:
+    void valueChanged();
+    void capacityChanged();
+    void recordingChanged();
+    void peakChanged();
+    void peakHoldTimeChanged();
+    void peakDecayRateChanged();
+    void statisticsChanged();
+    void appended(qint64 time, qreal value);
+    void cleared();
+
+private:
+    const Sample &bySequence(qint64 sequence) const;
+    void updatePeak(qint64 now);
+    void setPeak(qreal peak);
+
+    std::vector<Sample> m_samples;
+    int m_head = 0;   // Next write position
+    int m_count = 0;
+    qint64 m_sequence = 0;
+
+    // Monotonic queues of sequence numbers for sliding min / max
+    std::deque<qint64> m_minQueue;
+    std::deque<qint64> m_maxQueue;
+
+    qreal m_value = 0.0;
+    bool m_recording = true;
+
+    qreal m_peak = 0.0;
+    qreal m_heldPeak = 0.0;
+    qint64 m_peakTime = 0;
+    int m_peakHoldTime = 2000;
+    qreal m_peakDecayRate = 0.0;
+    QTimer m_peakTimer;
+
+    QElapsedTimer m_clock;
+};
+
+#endif // VALUEHISTORY_H
@@ -0,0 +1,213 @@
+#include "gaugepresets.h"
+
+#include <QCborArray>
+#include <QCborMap>
+#include <QCborValue>
+#include <QColor>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMetaMethod>
+#include <QMetaProperty>
+#include <QProperty>
+#include <QQmlProperty>
+#include <QSignalBlocker>
+
+namespace {
+
+const QString kPresetResource = QStringLiteral(":/DevDash/Gauges/presets.cbor");
+
+// Convert a compiled value to the QVariant type the property expects, once at load
+QVariant convertValue(const QString &type, const QCborValue &value)
+{
+    if (type == QLatin1String("color"))
+        return QColor::fromString(value.toString());
+    if (type == QLatin1String("real"))
+        return value.toDouble();
+    if (type == QLatin1String("int"))
+        return int(value.toInteger());
+    if (type == QLatin1String("bool"))
+        return value.toBool();
+    if (type == QLatin1String("string"))
+        return value.toString();
+    return value.toVariant();
+}
+
+} // namespace
+
+GaugePresets::GaugePresets(QObject *parent)
+    : QObject(parent)
+{
+    load();
+}
+
+void GaugePresets::load()
+{
+    QFile file(kPresetResource);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "GaugePresets: cannot open" << kPresetResource;
+        return;
+    }
+
+    QCborParserError error;
+    const QCborValue root = QCborValue::fromCbor(file.readAll(), &error);
+    if (error.error != QCborError::NoError || !root.isMap()) {
+        qWarning() << "GaugePresets: invalid preset resource:" << error.errorString();
+        return;
+    }
+
+    const QCborMap components = root.toMap();
+    for (auto component = components.begin(); component != components.end(); ++component) {
+        QHash<QString, Preset> &presets = m_presets[component.key().toString()];
+
+        const QCborMap entries = component.value().toMap();
+        for (auto entry = entries.begin(); entry != entries.end(); ++entry) {
+            const QCborMap data = entry.value().toMap();
+
+            Preset preset;
+            preset.name = data.value(QLatin1String("name")).toString();
+            preset.description = data.value(QLatin1String("description")).toString();
+            preset.source = data.value(QLatin1String("source")).toString();
+
+            const QCborArray properties = data.value(QLatin1String("properties")).toArray();
+            preset.properties.reserve(properties.size());
+            for (const QCborValue &property : properties) {
+                const QCborArray triple = property.toArray();
+                preset.properties.append({
+                    triple.at(0).toString().toUtf8(),
+                    convertValue(triple.at(1).toString(), triple.at(2))
+                });
+            }
+
+            presets.insert(entry.key().toString(), preset);
+        }
+    }
+}
+
+QStringList GaugePresets::components() const
+{
+    QStringList names = m_presets.keys();
+    names.sort();
+    return names;
+}
+
+QStringList GaugePresets::presets(const QString &component) const
+{
+    QStringList ids = m_presets.value(component).keys();
+    ids.sort();
+    return ids;
+}
+
+QVariantMap GaugePresets::preset(const QString &component, const QString &presetId) const
+{
+    const Preset *found = findPreset(component, presetId);
+    if (!found)
+        return {};
+
+    QVariantMap properties;
+    for (const PresetProperty &property : found->properties)
+        properties.insert(QString::fromUtf8(property.name), property.value);
+
+    return {
+        {QStringLiteral("name"), found->name},
+        {QStringLiteral("description"), found->description},
+        {QStringLiteral("source"), found->source},
+        {QStringLiteral("properties"), properties},
+    };
+}
+
+bool GaugePresets::apply(QObject *target, const QString &presetId, const QString &component)
+{
+    if (!target) {
+        qWarning() << "GaugePresets: cannot apply" << presetId << "to a null target";
+        return false;
+    }
+
+    const QString componentName = component.isEmpty() ? componentNameOf(target) : component;
+    const Preset *found = findPreset(componentName, presetId);
+    if (!found) {
+        qWarning() << "GaugePresets: no preset" << presetId << "for" << componentName;
+        return false;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    // Parameterless notify signals (all QML-declared properties) are
+    // re-emitted once everything is written: the blocker below swallows the
+    // original emissions, and with them every binding and handler update.
+    // Properties whose notify signal carries the value are written after the
+    // blocked batch so they notify normally.
+    QList<QMetaMethod> pendingNotifiers;
+    QList<std::pair<QQmlProperty, QVariant>> lateWrites;
+    int changedCount = 0;
+
+    // Group bindable (QProperty-based) properties such as geometry
+    Qt::beginPropertyUpdateGroup();
+    {
+        // Hold back change notifications so dependent bindings only
+        // re-evaluate against the complete preset
+        const QSignalBlocker blocker(target);
+
+        for (const PresetProperty &property : found->properties) {
+            QQmlProperty qmlProperty(target, QString::fromUtf8(property.name));
+            if (!qmlProperty.isWritable()) {
+                qWarning() << "GaugePresets:" << componentName << "has no writable property"
+                           << property.name;
+                continue;
+            }
+
+            if (qmlProperty.read() == property.value)
+                continue;
+
+            const QMetaMethod notifier =
+                target->metaObject()->property(qmlProperty.index()).notifySignal();
+            if (notifier.isValid() && notifier.parameterCount() > 0) {
+                lateWrites.append({qmlProperty, property.value});
+                continue;
+            }
+
+            if (!qmlProperty.write(property.value))
+                continue;
+
+            ++changedCount;
+            if (notifier.isValid() && !pendingNotifiers.contains(notifier))
+                pendingNotifiers.append(notifier);
+        }
+    }
+
+    // Unblocked: bindings on the target and elsewhere see the whole preset
+    for (const QMetaMethod &notifier : std::as_const(pendingNotifiers))
+        notifier.invoke(target, Qt::DirectConnection);
+
+    for (const auto &[qmlProperty, value] : std::as_const(lateWrites)) {
+        if (qmlProperty.write(value))
+            ++changedCount;
+    }
+    Qt::endPropertyUpdateGroup();
+
+    m_lastApplyTime = timer.nsecsElapsed() / 1.0e6;
+    emit applied(target, presetId, changedCount);
+    return true;
+}
+
+const GaugePresets::Preset *GaugePresets::findPreset(const QString &component,
+                                                      const QString &presetId) const
+{
+    const auto presets = m_presets.constFind(component);
+    if (presets == m_presets.constEnd())
+        return nullptr;
+
+    const auto preset = presets->constFind(presetId);
+    return preset != presets->constEnd() ? &preset.value() : nullptr;
+}
+
+QString GaugePresets::componentNameOf(const QObject *target)
+{
+    // QML-defined types report class names like "GaugeNeedle_QMLTYPE_12"
+    QString name = QString::fromLatin1(target->metaObject()->className());
+    const qsizetype suffix = name.indexOf(QLatin1String("_QML"));
+    if (suffix > 0)
+        name.truncate(suffix);
+    return name;
+}
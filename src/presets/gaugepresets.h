@@ -0,0 +1,103 @@
+#ifndef GAUGEPRESETS_H
+#define GAUGEPRESETS_H
+
+#include <QObject>
+#include <QHash>
+#include <QList>
+#include <QStringList>
+#include <QVariant>
+#include <QtQml/qqmlregistration.h>
+
+/**
+ * @brief Runtime access to the compiled gauge presets.
+ *
+ * Presets are authored as JSON under presets/<Component>/ and compiled at
+ * build time (scripts/compile-presets.py) into a CBOR resource. Compilation
+ * validates every property name and value against the component's QML
+ * declarations, so the runtime only has to convert and write values.
+ *
+ * apply() writes a whole preset as one batch:
+ * - Change notifications are held back until every value is written, so
+ *   bindings never see a half-applied preset and each fires at most once.
+ *   The notify signal of every written property is then emitted, which
+ *   updates bindings and runs onXChanged handlers inside and outside the
+ *   target. Any other signal the target emits while the values are
+ *   written is not delivered, so preset properties should not have
+ *   setters with side effects beyond their own notify signal
+ * - All writes happen before control returns to the event loop, so polish
+ *   and scene-graph sync run once for the whole preset
+ * - Values equal to the current value are skipped
+ *
+ * @example
+ * @code
+ * GaugeNeedle {
+ *     id: needle
+ *     Component.onCompleted: GaugePresets.apply(needle, "autometer")
+ * }
+ * @endcode
+ */
+class GaugePresets : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_SINGLETON
+    Q_PROPERTY(QStringList components READ components CONSTANT)
+    Q_PROPERTY(double lastApplyTime READ lastApplyTime NOTIFY applied)
+
+public:
+    explicit GaugePresets(QObject *parent = nullptr);
+
+    QStringList components() const;
+
+    /**
+     * @brief Duration of the most recent apply() in milliseconds.
+     */
+    double lastApplyTime() const { return m_lastApplyTime; }
+
+    /**
+     * @brief Preset ids (file names without .json) available for a component.
+     */
+    Q_INVOKABLE QStringList presets(const QString &component) const;
+
+    /**
+     * @brief Preset metadata and values: {name, description, source, properties}.
+     */
+    Q_INVOKABLE QVariantMap preset(const QString &component, const QString &presetId) const;
+
+    /**
+     * @brief Apply a preset to a gauge component as one batched update.
+     *
+     * @param target Component instance to modify
+     * @param presetId Preset id, e.g. "autometer"
+     * @param component Component name; derived from the target's type when empty
+     * @return true if the preset was found and applied
+     */
+    Q_INVOKABLE bool apply(QObject *target, const QString &presetId,
+                           const QString &component = QString());
+
+signals:
+    void applied(QObject *target, const QString &presetId, int changedCount);
+
+private:
+    struct PresetProperty {
+        QByteArray name;
+        QVariant value;
+    };
+
+    struct Preset {
+        QString name;
+        QString description;
+        QString source;
+        QList<PresetProperty> properties;
+    };
+
+    void load();
+    const Preset *findPreset(const QString &component, const QString &presetId) const;
+    static QString componentNameOf(const QObject *target);
+
+    // component -> preset id -> preset
+    QHash<QString, QHash<QString, Preset>> m_presets;
+    double m_lastApplyTime = 0.0;
+};
+
+#endif // GAUGEPRESETS_H
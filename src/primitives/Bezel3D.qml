@@ -1,5 +1,6 @@
 import QtQuick
 import QtQuick3D
+import "assets/lightprobe.js" as LightProbe
 
 /**
  * @brief 3D bezel ring using Qt Quick 3D with PBR chrome material.
@@ -123,7 +124,7 @@ Item {
 
             // IBL for realistic chrome reflections
             lightProbe: Texture {
-                source: "qrc:/DevDash/Gauges/Primitives/assets/studio.ktx"
+                source: LightProbe.source
             }
             probeExposure: root.iblExposure
         }
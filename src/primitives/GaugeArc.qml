@@ -164,6 +164,21 @@ Item {
      */
     property int animationDuration: 100
 
+    /**
+     * @brief Animate strokeColor and gradient changes (requires animated).
+     *
+     * Turn off while the colors are driven by an external clock, such as a
+     * GaugeThemes transition, so each step is not chased by a ColorAnimation.
+     *
+     * @default true
+     */
+    property bool colorAnimated: true
+
+    /**
+     * @brief False while the sweep is animating.
+     */
+    readonly property bool settled: !sweepAnimation.running
+
     // === Advanced ===
 
     /**
@@ -177,6 +192,14 @@ Item {
 
     // === Internal Implementation ===
 
+    // Software backend: draw from RasterCache instead of stroking the Shape
+    readonly property bool _raster: RasterCache.enabled
+
+    FrameSource {
+        active: sweepAnimation.running
+        reason: "arc sweep"
+    }
+
     implicitWidth: 400
     implicitHeight: 400
 
@@ -184,6 +207,7 @@ Item {
         id: shape
         anchors.fill: parent
         opacity: root.arcOpacity
+        visible: !root._raster
 
         // Antialiasing
         antialiasing: root.antialiasing
@@ -221,6 +245,7 @@ Item {
                 Behavior on sweepAngle {
                     enabled: root.animated
                     NumberAnimation {
+                        id: sweepAnimation
                         duration: root.animationDuration
                         easing.type: Easing.OutQuad
                     }
@@ -238,9 +263,33 @@ Item {
         }
     }
 
+    Loader {
+        active: root._raster
+        anchors.fill: parent
+        opacity: root.arcOpacity
+
+        sourceComponent: RasterPrimitive {
+            kind: RasterPrimitive.Arc
+            margin: root.strokeWidth / 2
+            // The full ring is cached once; the sweep animation only
+            // changes how much of it is shown
+            revealAngle: arc.sweepAngle
+            parameters: ({
+                centerX: root.centerX,
+                centerY: root.centerY,
+                radius: root.radius,
+                startAngle: root.startAngle,
+                strokeWidth: root.strokeWidth,
+                strokeColor: root.strokeColor,
+                fillColor: root.fillColor,
+                capStyle: root.capStyle
+            })
+        }
+    }
+
     // Color animation for stroke
     Behavior on strokeColor {
-        enabled: root.animated && !root.useGradient
+        enabled: root.animated && root.colorAnimated && !root.useGradient
         ColorAnimation {
             duration: root.animationDuration
         }
@@ -248,14 +297,14 @@ Item {
 
     // Gradient color animations
     Behavior on gradientStart {
-        enabled: root.animated && root.useGradient
+        enabled: root.animated && root.colorAnimated && root.useGradient
         ColorAnimation {
             duration: root.animationDuration
         }
     }
 
     Behavior on gradientStop {
-        enabled: root.animated && root.useGradient
+        enabled: root.animated && root.colorAnimated && root.useGradient
         ColorAnimation {
             duration: root.animationDuration
         }
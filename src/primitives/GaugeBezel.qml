@@ -137,6 +137,9 @@ Item {
     implicitWidth: outerRadius * 2
     implicitHeight: outerRadius * 2
 
+    // Software backend: draw from RasterCache; textured bezels keep the Image path
+    readonly property bool _raster: RasterCache.enabled && textureSource === ""
+
     // Bezel ring - using thick border for donut shape (pure Qt6, no masking needed)
     Rectangle {
         id: bezelRing
@@ -144,6 +147,7 @@ Item {
         height: root.outerRadius * 2
         radius: root.outerRadius
         anchors.centerIn: parent
+        visible: !root._raster
 
         // Transparent fill - the border IS the bezel
         color: "transparent"
@@ -266,4 +270,29 @@ Item {
             antialiasing: root.antialiasing
         }
     }
+
+    Loader {
+        active: root._raster
+        width: root.outerRadius * 2
+        height: root.outerRadius * 2
+        anchors.centerIn: parent
+        opacity: root.bezelOpacity
+
+        sourceComponent: RasterPrimitive {
+            kind: RasterPrimitive.Bezel
+            margin: 1
+            parameters: ({
+                outerRadius: root.outerRadius,
+                innerRadius: root.innerRadius,
+                style: root.style,
+                color: root.color,
+                borderWidth: root.borderWidth,
+                borderColor: root.borderColor,
+                chromeHighlight: root.chromeHighlight,
+                chromeShadow: root.chromeShadow,
+                chrome3dLightAngle: root.chrome3dLightAngle,
+                chrome3dMidtone: root.chrome3dMidtone
+            })
+        }
+    }
 }
@@ -202,6 +202,9 @@ Item {
     implicitWidth: diameter
     implicitHeight: diameter
 
+    // Software backend: draw from RasterCache; the shadow becomes a soft falloff
+    readonly property bool _raster: RasterCache.enabled
+
     // Container for shadow effect
     Item {
         id: capContainer
@@ -209,8 +212,9 @@ Item {
         width: root.diameter
         height: root.diameter
         opacity: root.capOpacity
+        visible: !root._raster
 
-        layer.enabled: root.hasShadow
+        layer.enabled: !root._raster && root.hasShadow
         layer.effect: MultiEffect {
             shadowEnabled: true
             shadowColor: root.shadowColor
@@ -323,4 +327,45 @@ Item {
             opacity: 0.4
         }
     }
+
+    Loader {
+        active: root._raster
+        anchors.centerIn: parent
+        width: root.diameter
+        height: root.diameter
+        opacity: root.capOpacity
+
+        sourceComponent: RasterPrimitive {
+            kind: RasterPrimitive.CenterCap
+            margin: root.hasShadow
+                ? Math.max(Math.abs(root.shadowOffsetX), Math.abs(root.shadowOffsetY))
+                  + root.diameter / 2 * root.shadowBlur + 1
+                : 1
+            parameters: ({
+                diameter: root.diameter,
+                borderWidth: root.borderWidth,
+                color: root.color,
+                borderColor: root.borderColor,
+                hasGradient: root.hasGradient,
+                gradientTop: root.gradientTop,
+                gradientBottom: root.gradientBottom,
+                hasShadow: root.hasShadow,
+                shadowColor: root.shadowColor,
+                shadowOffsetX: root.shadowOffsetX,
+                shadowOffsetY: root.shadowOffsetY,
+                shadowBlur: root.shadowBlur,
+                shadowOpacity: root.shadowOpacity,
+                hasHighlight: root.hasHighlight,
+                highlightColor: root.highlightColor,
+                highlightWidth: root.highlightWidth,
+                domed: root.domed,
+                domedHighlightX: root.domedHighlightX,
+                domedHighlightY: root.domedHighlightY,
+                domedHighlightColor: root.domedHighlightColor,
+                domedMidtoneColor: root.domedMidtoneColor,
+                domedShadowColor: root.domedShadowColor,
+                domedChromeReflection: root.domedChromeReflection
+            })
+        }
+    }
 }
@@ -257,13 +257,17 @@ Item {
     readonly property real tickX: width / 2 - tickWidth / 2
     readonly property real tickY: (height / 2) - distanceFromCenter
 
+    // Software backend: draw from RasterCache; glow and shadow are dropped
+    readonly property bool _raster: RasterCache.enabled
+
     // Main tick container with effects
     Item {
         id: tickContainer
         anchors.fill: parent
         opacity: root.tickOpacity
+        visible: !root._raster
 
-        layer.enabled: root.hasGlow || root.hasShadow
+        layer.enabled: !root._raster && (root.hasGlow || root.hasShadow)
         layer.effect: MultiEffect {
             // Glow effect (blur + colorization)
             blurEnabled: root.hasGlow
@@ -562,4 +566,42 @@ Item {
             }
         }
     }
+
+    // One image per distinct look, shared by every tick of a scale;
+    // placed and rotated like the rectangle tick
+    Loader {
+        active: root._raster
+        x: root.tickX
+        y: root.tickY
+        width: root.tickWidth
+        height: root.length
+        opacity: root.tickOpacity
+        transform: Rotation {
+            origin.x: root.tickWidth / 2
+            origin.y: root.distanceFromCenter
+            angle: root.angle
+        }
+
+        sourceComponent: RasterPrimitive {
+            kind: RasterPrimitive.Tick
+            margin: Math.max(root.tickWidth * 1.5, root.showInnerCircle ? root.innerCircleDiameter / 2 : 0) + 1
+            parameters: ({
+                tickShape: root.tickShape,
+                color: root.color,
+                roundedEnds: root.roundedEnds,
+                hasGradient: root.hasGradient,
+                gradientStart: root.gradientStart,
+                gradientEnd: root.gradientEnd,
+                raised: root.raised,
+                bevelWidth: root.bevelWidth,
+                bevelHighlight: root.bevelHighlight,
+                bevelShadow: root.bevelShadow,
+                bevelHighlightOpacity: root.bevelHighlightOpacity,
+                bevelShadowOpacity: root.bevelShadowOpacity,
+                showInnerCircle: root.showInnerCircle,
+                innerCircleDiameter: root.innerCircleDiameter,
+                innerCircleColor: root.innerCircleColor
+            })
+        }
+    }
 }
@@ -119,13 +119,16 @@ Item {
     readonly property real _centerX: width / 2
     readonly property real _centerY: height / 2
 
+    // Software backend: draw from RasterCache instead of layered Shapes and a Canvas
+    readonly property bool _raster: RasterCache.enabled
+
     implicitWidth: 400
     implicitHeight: 400
 
     // Top highlight arc (curved glass reflection)
     Shape {
         id: highlightShape
-        visible: root.highlightEnabled && root.highlightIntensity > 0
+        visible: !root._raster && root.highlightEnabled && root.highlightIntensity > 0
         anchors.fill: parent
         layer.enabled: true
         layer.smooth: true
@@ -198,7 +201,7 @@ Item {
     // Edge vignette (lens curvature effect)
     Rectangle {
         id: vignetteLayer
-        visible: root.vignetteEnabled && root.vignetteIntensity > 0
+        visible: !root._raster && root.vignetteEnabled && root.vignetteIntensity > 0
         anchors.fill: parent
 
         // Circular clip
@@ -263,7 +266,7 @@ Item {
     // Subtle curved reflection line
     Shape {
         id: reflectionShape
-        visible: root.reflectionEnabled && root.reflectionIntensity > 0
+        visible: !root._raster && root.reflectionEnabled && root.reflectionIntensity > 0
         anchors.fill: parent
 
         preferredRendererType: typeof Shape.CurveRenderer !== 'undefined'
@@ -286,4 +289,28 @@ Item {
             }
         }
     }
+
+    Loader {
+        active: root._raster
+        anchors.fill: parent
+
+        sourceComponent: RasterPrimitive {
+            kind: RasterPrimitive.Glass
+            margin: 1
+            parameters: ({
+                radius: root.radius,
+                highlightEnabled: root.highlightEnabled,
+                highlightIntensity: root.highlightIntensity,
+                highlightColor: root.highlightColor,
+                highlightAngle: root.highlightAngle,
+                highlightOffset: root.highlightOffset,
+                vignetteEnabled: root.vignetteEnabled,
+                vignetteIntensity: root.vignetteIntensity,
+                vignetteColor: root.vignetteColor,
+                vignetteInnerRadius: root.vignetteInnerRadius,
+                reflectionEnabled: root.reflectionEnabled,
+                reflectionIntensity: root.reflectionIntensity
+            })
+        }
+    }
 }
@@ -184,9 +184,14 @@ Item {
     // Select gradient based on style
     readonly property var activeGradient: gradientStyle === "ridge" ? ridgeGradient : cylinderGradient
 
+    // Software backend: draw from RasterCache; the needle's rotation
+    // transforms the cached image instead of re-stroking the path
+    readonly property bool _raster: RasterCache.enabled
+
     Shape {
         id: bodyShape
         anchors.fill: parent
+        visible: !root._raster
         antialiasing: root.antialiasing
 
         // Use CurveRenderer for smooth edges (Qt 6.6+)
@@ -286,6 +291,35 @@ Item {
         }
     }
 
+    Loader {
+        active: root._raster
+        width: root.implicitWidth
+        height: root.length
+
+        sourceComponent: RasterPrimitive {
+            kind: RasterPrimitive.NeedleBody
+            margin: root.borderWidth / 2 + root.bevelWidth / 2 + 1
+            parameters: ({
+                rear: false,
+                length: root.length,
+                pivotWidth: root.pivotWidth,
+                tipWidth: root.tipWidth,
+                shape: root.shape,
+                color: root.color,
+                hasGradient: root.hasGradient,
+                gradientStyle: root.gradientStyle,
+                gradientHighlight: root.gradientHighlight,
+                gradientShadow: root.gradientShadow,
+                borderWidth: root.borderWidth,
+                borderColor: root.borderColor,
+                hasBevel: root.hasBevel,
+                bevelWidth: root.bevelWidth,
+                bevelHighlight: root.bevelHighlight,
+                bevelShadow: root.bevelShadow
+            })
+        }
+    }
+
     // Convex/Concave shapes use curved paths instead of straight lines
     // For simplicity in initial implementation, tapered/straight are supported
     // Convex/Concave can be added as enhancement using PathQuad
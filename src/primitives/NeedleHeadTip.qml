@@ -138,12 +138,15 @@ Item {
     implicitWidth: shape === "arrow" || shape === "diamond" ? baseWidth * 1.5 : baseWidth
     implicitHeight: actualLength
 
+    // Software backend: draw from RasterCache instead of the Loader shapes
+    readonly property bool _raster: RasterCache.enabled
+
     // Don't render if shape is "none"
     visible: shape !== "none"
 
     // Pointed tip: simple triangle to a point
     Loader {
-        active: root.shape === "pointed"
+        active: !root._raster && root.shape === "pointed"
         anchors.fill: parent
 
         sourceComponent: Item {
@@ -219,7 +222,7 @@ Item {
 
     // Rounded tip: tapered with arc at end
     Loader {
-        active: root.shape === "rounded"
+        active: !root._raster && root.shape === "rounded"
         anchors.fill: parent
 
         sourceComponent: Item {
@@ -270,7 +273,7 @@ Item {
 
     // Flat tip: simple rectangle cap
     Loader {
-        active: root.shape === "flat"
+        active: !root._raster && root.shape === "flat"
         anchors.fill: parent
 
         sourceComponent: Rectangle {
@@ -286,7 +289,7 @@ Item {
 
     // Arrow tip: V-notched arrow head
     Loader {
-        active: root.shape === "arrow"
+        active: !root._raster && root.shape === "arrow"
         anchors.fill: parent
 
         sourceComponent: Item {
@@ -339,7 +342,7 @@ Item {
 
     // Diamond tip: rhombus shape
     Loader {
-        active: root.shape === "diamond"
+        active: !root._raster && root.shape === "diamond"
         anchors.fill: parent
 
         sourceComponent: Item {
@@ -388,4 +391,32 @@ Item {
             }
         }
     }
+
+    Loader {
+        active: root._raster
+        width: root.implicitWidth
+        height: root.implicitHeight
+
+        sourceComponent: RasterPrimitive {
+            kind: RasterPrimitive.NeedleHeadTip
+            margin: root.borderWidth / 2 + root.bevelWidth / 2 + 1
+            parameters: ({
+                shape: root.shape,
+                baseWidth: root.baseWidth,
+                length: root.actualLength,
+                width: root.implicitWidth,
+                height: root.implicitHeight,
+                color: root.color,
+                hasGradient: root.hasGradient,
+                gradientHighlight: root.gradientHighlight,
+                gradientShadow: root.gradientShadow,
+                borderWidth: root.borderWidth,
+                borderColor: root.borderColor,
+                hasBevel: root.hasBevel,
+                bevelWidth: root.bevelWidth,
+                bevelHighlight: root.bevelHighlight,
+                bevelShadow: root.bevelShadow
+            })
+        }
+    }
 }
@@ -158,9 +158,14 @@ Item {
         GradientStop { position: 1.0; color: root.gradientShadow }
     }
 
+    // Software backend: draw from RasterCache; the needle's rotation
+    // transforms the cached image instead of re-stroking the path
+    readonly property bool _raster: RasterCache.enabled
+
     Shape {
         id: bodyShape
         anchors.fill: parent
+        visible: !root._raster
         antialiasing: root.antialiasing
 
         // Use CurveRenderer for smooth edges (Qt 6.6+)
@@ -253,4 +258,32 @@ Item {
             }
         }
     }
+
+    Loader {
+        active: root._raster
+        width: root.implicitWidth
+        height: root.length
+
+        sourceComponent: RasterPrimitive {
+            kind: RasterPrimitive.NeedleBody
+            margin: root.borderWidth / 2 + root.bevelWidth / 2 + 1
+            parameters: ({
+                rear: true,
+                length: root.length,
+                pivotWidth: root.pivotWidth,
+                tipWidth: root.tipWidth,
+                shape: root.shape,
+                color: root.color,
+                hasGradient: root.hasGradient,
+                gradientHighlight: root.gradientHighlight,
+                gradientShadow: root.gradientShadow,
+                borderWidth: root.borderWidth,
+                borderColor: root.borderColor,
+                hasBevel: root.hasBevel,
+                bevelWidth: root.bevelWidth,
+                bevelHighlight: root.bevelHighlight,
+                bevelShadow: root.bevelShadow
+            })
+        }
+    }
 }
@@ -147,12 +147,15 @@ Item {
         : shape === "counterweight" ? baseWidth * 1.5 : baseWidth
     implicitHeight: shape === "counterweight" ? baseWidth * 1.5 : actualLength
 
+    // Software backend: draw from RasterCache instead of the Loader shapes
+    readonly property bool _raster: RasterCache.enabled
+
     // Don't render if shape is "none"
     visible: shape !== "none"
 
     // Tapered tip: simple triangle to a point (mirror of front)
     Loader {
-        active: root.shape === "tapered"
+        active: !root._raster && root.shape === "tapered"
         anchors.fill: parent
 
         sourceComponent: Item {
@@ -226,7 +229,7 @@ Item {
 
     // Crescent/wrench counterweight shape
     Loader {
-        active: root.shape === "crescent"
+        active: !root._raster && root.shape === "crescent"
         anchors.fill: parent
 
         sourceComponent: Item {
@@ -294,7 +297,7 @@ Item {
 
     // Counterweight: circular dot
     Loader {
-        active: root.shape === "counterweight"
+        active: !root._raster && root.shape === "counterweight"
         anchors.fill: parent
 
         sourceComponent: Item {
@@ -342,7 +345,7 @@ Item {
 
     // Wedge: wide triangular shape
     Loader {
-        active: root.shape === "wedge"
+        active: !root._raster && root.shape === "wedge"
         anchors.fill: parent
 
         sourceComponent: Item {
@@ -388,7 +391,7 @@ Item {
 
     // Flat tip: simple rectangle cap
     Loader {
-        active: root.shape === "flat"
+        active: !root._raster && root.shape === "flat"
         anchors.fill: parent
 
         sourceComponent: Rectangle {
@@ -401,4 +404,33 @@ Item {
             antialiasing: root.antialiasing
         }
     }
+
+    Loader {
+        active: root._raster
+        width: root.implicitWidth
+        height: root.implicitHeight
+
+        sourceComponent: RasterPrimitive {
+            kind: RasterPrimitive.NeedleTailTip
+            margin: root.borderWidth / 2 + root.bevelWidth / 2 + 1
+            parameters: ({
+                shape: root.shape,
+                baseWidth: root.baseWidth,
+                length: root.actualLength,
+                width: root.implicitWidth,
+                height: root.implicitHeight,
+                curveAmount: root.curveAmount,
+                color: root.color,
+                hasGradient: root.hasGradient,
+                gradientHighlight: root.gradientHighlight,
+                gradientShadow: root.gradientShadow,
+                borderWidth: root.borderWidth,
+                borderColor: root.borderColor,
+                hasBevel: root.hasBevel,
+                bevelWidth: root.bevelWidth,
+                bevelHighlight: root.bevelHighlight,
+                bevelShadow: root.bevelShadow
+            })
+        }
+    }
 }
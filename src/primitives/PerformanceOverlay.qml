@@ -3,10 +3,13 @@ import QtQuick
 /**
  * @brief Performance overlay displaying FPS and frame timing.
  *
- * PerformanceOverlay provides real-time performance metrics using
- * FrameAnimation for accurate frame timing. Displays FPS counter,
+ * PerformanceOverlay provides real-time performance metrics from the
+ * window's own frame signals (FrameStats). Displays FPS counter,
  * frame time, and optional frame time graph.
  *
+ * The overlay never renders frames of its own: it refreshes twice a second
+ * while the window is rendering and shows "idle" once nothing moves.
+ *
  * @example
  * @code
  * PerformanceOverlay {
@@ -75,49 +78,47 @@ Item {
     /**
      * @brief Current FPS (averaged over sampleCount frames).
      */
-    readonly property real fps: _avgFps
+    readonly property real fps: stats.fps
 
     /**
      * @brief Current frame time in milliseconds.
      */
-    readonly property real frameTimeMs: _lastFrameTime
+    readonly property real frameTimeMs: stats.lastFrameTime
+
+    /**
+     * @brief True while the window renders no frames.
+     */
+    readonly property bool idle: !stats.active
 
     // === Internal ===
 
     property real _lastFrameTime: 0
     property real _avgFps: 0
     property var _frameTimes: []
-    property int _frameIndex: 0
 
     implicitWidth: 120
     implicitHeight: showGraph ? 80 : 40
 
-    // Frame timing using FrameAnimation
-    FrameAnimation {
-        id: frameTimer
+    // Frame timing from the window's frame signals
+    FrameStats {
+        id: stats
+        window: root.Window.window
         running: root.visible
+        sampleCount: root.sampleCount
+    }
 
-        onTriggered: {
-            // frameTime is in seconds
-            root._lastFrameTime = frameTime * 1000
-
-            // Store frame time for averaging
-            if (root._frameTimes.length < root.sampleCount) {
-                root._frameTimes.push(root._lastFrameTime)
-            } else {
-                root._frameTimes[root._frameIndex] = root._lastFrameTime
-            }
-            root._frameIndex = (root._frameIndex + 1) % root.sampleCount
+    // A display bound to every frame would itself request the next frame,
+    // so the numbers are sampled on a timer that only runs while other
+    // content keeps the window rendering
+    Timer {
+        interval: 500
+        repeat: true
+        running: root.visible && stats.active
 
-            // Calculate average FPS
-            if (root._frameTimes.length > 0) {
-                var sum = 0
-                for (var i = 0; i < root._frameTimes.length; i++) {
-                    sum += root._frameTimes[i]
-                }
-                var avgFrameTime = sum / root._frameTimes.length
-                root._avgFps = avgFrameTime > 0 ? 1000 / avgFrameTime : 0
-            }
+        onTriggered: {
+            root._lastFrameTime = stats.lastFrameTime
+            root._avgFps = stats.fps
+            root._frameTimes = stats.frameTimes()
 
             // Update graph
             if (root.showGraph) {
@@ -142,11 +143,11 @@ Item {
 
         Text {
             id: fpsText
-            text: root._avgFps.toFixed(1) + " FPS"
+            text: root.idle ? "idle" : root._avgFps.toFixed(1) + " FPS"
             font.family: "monospace"
             font.pixelSize: 14
             font.bold: true
-            color: root._avgFps >= 45 ? root.textColor :
+            color: root.idle || root._avgFps >= 45 ? root.textColor :
                    root._avgFps >= 30 ? root.warningColor : root.criticalColor
         }
 
@@ -193,8 +194,7 @@ Item {
             var startIdx = root._frameTimes.length - samples
 
             for (var i = 0; i < samples; i++) {
-                var idx = (startIdx + i + root._frameIndex) % root._frameTimes.length
-                var ft = root._frameTimes[idx]
+                var ft = root._frameTimes[startIdx + i]
                 var x = (i / samples) * width
                 var y = height - Math.min((ft / 33.33) * height, height)
 
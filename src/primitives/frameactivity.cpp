@@ -0,0 +1,181 @@
+#include "frameactivity.h"
+
+#include <QJSEngine>
+#include <QQuickItem>
+
+namespace {
+
+// One-shot reasons kept between two frames; more in one frame add nothing
+constexpr int kMaxPendingReasons = 32;
+
+} // namespace
+
+// === FrameActivity ===
+
+FrameActivity::FrameActivity(QObject *parent)
+    : QObject(parent)
+{
+}
+
+FrameActivity *FrameActivity::instance()
+{
+    static FrameActivity *activity = new FrameActivity;
+    return activity;
+}
+
+FrameActivity *FrameActivity::create(QQmlEngine *qmlEngine, QJSEngine *jsEngine)
+{
+    Q_UNUSED(qmlEngine)
+    Q_UNUSED(jsEngine)
+
+    // FrameSource and FrameStats reach the same instance from C++
+    FrameActivity *activity = instance();
+    QJSEngine::setObjectOwnership(activity, QJSEngine::CppOwnership);
+    return activity;
+}
+
+QStringList FrameActivity::activeReasons() const
+{
+    QStringList reasons;
+    reasons.reserve(m_active.size());
+    for (const FrameSource *source : m_active)
+        reasons.append(describe(source->source()) + QStringLiteral(": ") + source->reason());
+    return reasons;
+}
+
+void FrameActivity::setTracing(bool tracing)
+{
+    if (m_tracing == tracing)
+        return;
+
+    m_tracing = tracing;
+    if (!m_tracing)
+        m_pending.clear();
+    emit tracingChanged();
+}
+
+void FrameActivity::request(QObject *source, const QString &reason)
+{
+    if (!m_tracing)
+        return;
+
+    if (m_pending.size() < kMaxPendingReasons)
+        m_pending.append(describe(source) + QStringLiteral(": ") + reason);
+    emit frameRequested(source, reason);
+}
+
+QString FrameActivity::describe(QObject *source) const
+{
+    if (!source)
+        return QString();
+
+    for (QObject *object = source; object;) {
+        if (!object->objectName().isEmpty())
+            return object->objectName();
+        auto *item = qobject_cast<QQuickItem *>(object);
+        object = item && item->parentItem() ? item->parentItem() : object->parent();
+    }
+
+    // "GaugeNeedle_QMLTYPE_12" -> "GaugeNeedle"
+    QString name = QString::fromLatin1(source->metaObject()->className());
+    const qsizetype suffix = name.indexOf(QLatin1String("_QML"));
+    if (suffix > 0)
+        name.truncate(suffix);
+    return name;
+}
+
+QStringList FrameActivity::takeFrameReasons()
+{
+    QStringList reasons = activeReasons();
+    reasons.append(m_pending);
+    m_pending.clear();
+    return reasons;
+}
+
+void FrameActivity::setActive(FrameSource *source, bool active)
+{
+    if (active == m_active.contains(source))
+        return;
+
+    if (active)
+        m_active.append(source);
+    else
+        m_active.removeOne(source);
+    emit activeChanged();
+
+    if (active)
+        emit frameRequested(source->source(), source->reason());
+}
+
+// === FrameSource ===
+
+FrameSource::FrameSource(QObject *parent)
+    : QObject(parent)
+{
+}
+
+FrameSource::~FrameSource()
+{
+    if (m_registered)
+        FrameActivity::instance()->setActive(this, false);
+}
+
+void FrameSource::componentComplete()
+{
+    m_complete = true;
+    update();
+}
+
+void FrameSource::setActive(bool active)
+{
+    if (m_active == active)
+        return;
+
+    m_active = active;
+    update();
+    emit activeChanged();
+}
+
+void FrameSource::setReason(const QString &reason)
+{
+    if (m_reason == reason)
+        return;
+
+    m_reason = reason;
+    emit reasonChanged();
+    if (m_registered)
+        emit FrameActivity::instance()->activeChanged();
+}
+
+QObject *FrameSource::source() const
+{
+    return m_source ? m_source.data() : parent();
+}
+
+void FrameSource::setSource(QObject *source)
+{
+    if (m_source == source)
+        return;
+
+    m_source = source;
+    emit sourceChanged();
+    if (m_registered)
+        emit FrameActivity::instance()->activeChanged();
+}
+
+void FrameSource::request()
+{
+    FrameActivity::instance()->request(source(), m_reason);
+}
+
+void FrameSource::update()
+{
+    // Bindings settle before componentComplete; a transient active state
+    // during creation is not reported
+    const bool registered = m_complete && m_active;
+    if (m_registered == registered)
+        return;
+
+    m_registered = registered;
+    FrameActivity::instance()->setActive(this, registered);
+}
@@ -0,0 +1,181 @@
+#ifndef FRAMEACTIVITY_H
+#define FRAMEACTIVITY_H
+
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QQmlParserStatus>
+#include <QStringList>
+#include <QtQml/qqmlregistration.h>
+
+class QQmlEngine;
+class QJSEngine;
+class FrameSource;
+
+/**
+ * @brief Why frames are being rendered, and for which gauge.
+ *
+ * Gauges render only while something moves. Every animation that keeps
+ * the window rendering - a needle settling, an arc sweeping, an alert
+ * pulsing - is declared with a FrameSource, which registers here while it
+ * is active. idle is true when no source is active; a dashboard with
+ * constant input then requests no frames at all.
+ *
+ * Sources are named after the nearest object with an objectName, so name
+ * your gauges to see which one keeps the window busy. With tracing on,
+ * gauges also report one-shot requests (a value change that repaints once).
+ * frameRequested is emitted for both; FrameStats attaches the reasons to
+ * the frame they caused.
+ *
+ * @example
+ * @code
+ * RadialGauge { objectName: "coolant"; value: ecu.coolant }
+ * Connections {
+ *     target: FrameActivity
+ *     function onFrameRequested(source, reason) {
+ *         console.log(FrameActivity.describe(source), reason)  // "coolant needle settling"
+ *     }
+ * }
+ * @endcode
+ */
+class FrameActivity : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_SINGLETON
+    Q_PROPERTY(int activeCount READ activeCount NOTIFY activeChanged)
+    Q_PROPERTY(bool idle READ isIdle NOTIFY activeChanged)
+    Q_PROPERTY(QStringList activeReasons READ activeReasons NOTIFY activeChanged)
+    Q_PROPERTY(bool tracing READ isTracing WRITE setTracing NOTIFY tracingChanged)
+
+public:
+    static FrameActivity *instance();
+    static FrameActivity *create(QQmlEngine *qmlEngine, QJSEngine *jsEngine);
+
+    int activeCount() const { return int(m_active.size()); }
+    bool isIdle() const { return m_active.isEmpty(); }
+
+    /**
+     * @brief "<gauge>: <reason>" for every active source.
+     */
+    QStringList activeReasons() const;
+
+    /**
+     * @brief Also report one-shot requests such as value changes.
+     *
+     * Off by default: it costs a call per value change and gauge.
+     *
+     * @default false
+     */
+    bool isTracing() const { return m_tracing; }
+    void setTracing(bool tracing);
+
+    /**
+     * @brief Reports a one-shot frame request; ignored unless tracing.
+     */
+    Q_INVOKABLE void request(QObject *source, const QString &reason);
+
+    /**
+     * @brief Name of the nearest object with an objectName, walking up the
+     * item tree, or the QML type name of source.
+     */
+    Q_INVOKABLE QString describe(QObject *source) const;
+
+    /**
+     * @brief Reasons for the frame being rendered: the active sources and
+     * the one-shot requests since the last call.
+     */
+    QStringList takeFrameReasons();
+
+signals:
+    void activeChanged();
+    void tracingChanged();
+
+    /**
+     * @brief Emitted when a source becomes active or a request is reported.
+     */
+    void frameRequested(QObject *source, const QString &reason);
+
+private:
+    friend class FrameSource;
+
+    explicit FrameActivity(QObject *parent = nullptr);
+
+    void setActive(FrameSource *source, bool active);
+
+    QList<FrameSource *> m_active;
+    QStringList m_pending;
+    bool m_tracing = false;
+};
+
+/**
+ * @brief Declares something that keeps the window rendering.
+ *
+ * Bind active to the running state of an animation. While active, the
+ * source is registered with FrameActivity, attributed to source (by
+ * default the object the FrameSource is declared in).
+ *
+ * @example
+ * @code
+ * SpringAnimation { id: spring; ... }
+ * FrameSource { active: spring.running; reason: "needle settling" }
+ * @endcode
+ */
+class FrameSource : public QObject, public QQmlParserStatus
+{
+    Q_OBJECT
+    QML_ELEMENT
+    Q_INTERFACES(QQmlParserStatus)
+    Q_PROPERTY(bool active READ isActive WRITE setActive NOTIFY activeChanged)
+    Q_PROPERTY(QString reason READ reason WRITE setReason NOTIFY reasonChanged)
+    Q_PROPERTY(QObject *source READ source WRITE setSource NOTIFY sourceChanged)
+
+public:
+    explicit FrameSource(QObject *parent = nullptr);
+    ~FrameSource() override;
+
+    /**
+     * @brief True while this source is rendering frames.
+     * @default false
+     */
+    bool isActive() const { return m_active; }
+    void setActive(bool active);
+
+    /**
+     * @brief Short description, e.g. "needle settling".
+     * @default ""
+     */
+    QString reason() const { return m_reason; }
+    void setReason(const QString &reason);
+
+    /**
+     * @brief Object the frames are attributed to.
+     * @default the parent object
+     */
+    QObject *source() const;
+    void setSource(QObject *source);
+
+    /**
+     * @brief Reports a one-shot request for this source (when tracing).
+     */
+    Q_INVOKABLE void request();
+
+    void classBegin() override {}
+    void componentComplete() override;
+
+signals:
+    void activeChanged();
+    void reasonChanged();
+    void sourceChanged();
+
+private:
+    void update();
+
+    bool m_active = false;
+    bool m_registered = false;
+    bool m_complete = false;
+    QString m_reason;
+    QPointer<QObject> m_source;
+};
+
+#endif // FRAMEACTIVITY_H
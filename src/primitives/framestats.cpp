@@ -0,0 +1,148 @@
+#include "framestats.h"
+
+#include "frameactivity.h"
+
+#include <QQuickWindow>
+
+#include <numeric>
+
+FrameStats::FrameStats(QObject *parent)
+    : QObject(parent)
+{
+    m_clock.start();
+    m_idleTimer.setSingleShot(true);
+    connect(&m_idleTimer, &QTimer::timeout, this, [this]() {
+        setActive(false);
+    });
+}
+
+// === Properties ===
+
+void FrameStats::setWindow(QQuickWindow *window)
+{
+    if (m_window == window)
+        return;
+
+    m_window = window;
+    connectWindow();
+    emit windowChanged();
+}
+
+void FrameStats::setRunning(bool running)
+{
+    if (m_running == running)
+        return;
+
+    m_running = running;
+    connectWindow();
+    emit runningChanged();
+}
+
+void FrameStats::setSampleCount(int count)
+{
+    count = qMax(1, count);
+    if (m_sampleCount == count)
+        return;
+
+    m_sampleCount = count;
+    m_samples.clear();
+    m_sampleIndex = 0;
+    emit sampleCountChanged();
+}
+
+void FrameStats::setIdleTimeout(int ms)
+{
+    ms = qMax(1, ms);
+    if (m_idleTimeout == ms)
+        return;
+
+    m_idleTimeout = ms;
+    emit idleTimeoutChanged();
+}
+
+qreal FrameStats::frameTime() const
+{
+    if (m_samples.isEmpty())
+        return 0.0;
+    return std::accumulate(m_samples.cbegin(), m_samples.cend(), 0.0) / m_samples.size();
+}
+
+qreal FrameStats::fps() const
+{
+    const qreal time = frameTime();
+    return time > 0.0 ? 1000.0 / time : 0.0;
+}
+
+QList<qreal> FrameStats::frameTimes() const
+{
+    if (m_samples.size() < m_sampleCount)
+        return m_samples;
+
+    // Full ring: the oldest sample is the next one to be overwritten
+    QList<qreal> times;
+    times.reserve(m_samples.size());
+    times.append(m_samples.mid(m_sampleIndex));
+    times.append(m_samples.mid(0, m_sampleIndex));
+    return times;
+}
+
+void FrameStats::reset()
+{
+    m_samples.clear();
+    m_sampleIndex = 0;
+    m_frameCount = 0;
+    m_lastFrameTime = 0.0;
+    m_lastFrameReasons.clear();
+    m_lastFrame = -1;
+    m_idleTimer.stop();
+    setActive(false);
+    emit frameRendered();
+}
+
+// === Frames ===
+
+void FrameStats::connectWindow()
+{
+    disconnect(m_connection);
+    m_connection = {};
+    m_lastFrame = -1;
+    m_idleTimer.stop();
+    setActive(false);
+
+    // afterAnimating is emitted on the GUI thread once per frame, with every
+    // render loop; nothing here asks the window for another frame
+    if (m_window && m_running)
+        m_connection = connect(m_window, &QQuickWindow::afterAnimating, this, &FrameStats::onFrame);
+}
+
+void FrameStats::onFrame()
+{
+    const qint64 now = m_clock.nsecsElapsed();
+    const qreal interval = m_lastFrame < 0 ? -1.0 : (now - m_lastFrame) / 1e6;
+    m_lastFrame = now;
+    ++m_frameCount;
+
+    // Only frames of a burst are timed; the first frame after idle is not
+    if (interval >= 0.0 && interval <= m_idleTimeout) {
+        m_lastFrameTime = interval;
+        if (m_samples.size() < m_sampleCount)
+            m_samples.append(interval);
+        else
+            m_samples[m_sampleIndex] = interval;
+        m_sampleIndex = (m_sampleIndex + 1) % m_sampleCount;
+        setActive(true);
+    }
+    m_idleTimer.start(m_idleTimeout);
+
+    m_lastFrameReasons = FrameActivity::instance()->takeFrameReasons();
+    emit frameRendered();
+}
+
+void FrameStats::setActive(bool active)
+{
+    if (m_active == active)
+        return;
+
+    m_active = active;
+    emit activeChanged();
+}
@@ -0,0 +1,143 @@
+#ifndef FRAMESTATS_H
+#define FRAMESTATS_H
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QStringList>
+#include <QTimer>
+#include <QtQml/qqmlregistration.h>
+
+class QQuickWindow;
+
+/**
+ * @brief Frame statistics from the window's own frame signals.
+ *
+ * Counts the frames window actually renders by listening to
+ * QQuickWindow::afterAnimating. Unlike a FrameAnimation, it never requests
+ * a frame itself, so measuring an idle window keeps it idle.
+ *
+ * Frame times are the intervals between consecutive frames of a burst.
+ * A frame more than idleTimeout after the previous one starts a new burst
+ * and adds no sample, so idle periods do not drag fps down. active is true
+ * while a burst is running.
+ *
+ * lastFrameReasons lists why the last frame was rendered, as reported to
+ * FrameActivity.
+ *
+ * Do not bind visible items to properties notified by frameRendered: each
+ * repaint would cause the next frame. Refresh a display from a timer that
+ * only runs while active, as PerformanceOverlay does.
+ *
+ * @example
+ * @code
+ * FrameStats {
+ *     id: stats
+ *     window: root.Window.window
+ * }
+ * Timer { running: stats.active; interval: 1000; repeat: true
+ *         onTriggered: console.log(stats.fps.toFixed(1), stats.lastFrameReasons) }
+ * @endcode
+ */
+class FrameStats : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    Q_PROPERTY(QQuickWindow *window READ window WRITE setWindow NOTIFY windowChanged)
+    Q_PROPERTY(bool running READ isRunning WRITE setRunning NOTIFY runningChanged)
+    Q_PROPERTY(int sampleCount READ sampleCount WRITE setSampleCount NOTIFY sampleCountChanged)
+    Q_PROPERTY(int idleTimeout READ idleTimeout WRITE setIdleTimeout NOTIFY idleTimeoutChanged)
+    Q_PROPERTY(int frameCount READ frameCount NOTIFY frameRendered)
+    Q_PROPERTY(qreal fps READ fps NOTIFY frameRendered)
+    Q_PROPERTY(qreal frameTime READ frameTime NOTIFY frameRendered)
+    Q_PROPERTY(qreal lastFrameTime READ lastFrameTime NOTIFY frameRendered)
+    Q_PROPERTY(QStringList lastFrameReasons READ lastFrameReasons NOTIFY frameRendered)
+    Q_PROPERTY(bool active READ isActive NOTIFY activeChanged)
+
+public:
+    explicit FrameStats(QObject *parent = nullptr);
+
+    QQuickWindow *window() const { return m_window; }
+    void setWindow(QQuickWindow *window);
+
+    /**
+     * @brief Count frames; stopped statistics keep their last values.
+     * @default true
+     */
+    bool isRunning() const { return m_running; }
+    void setRunning(bool running);
+
+    /**
+     * @brief Frame times averaged for fps and frameTime.
+     * @default 60
+     */
+    int sampleCount() const { return m_sampleCount; }
+    void setSampleCount(int count);
+
+    /**
+     * @brief Milliseconds without a frame after which the window is idle.
+     * @default 250
+     */
+    int idleTimeout() const { return m_idleTimeout; }
+    void setIdleTimeout(int ms);
+
+    /**
+     * @brief Frames rendered since the statistics started or were reset.
+     */
+    int frameCount() const { return m_frameCount; }
+
+    qreal fps() const;
+
+    /**
+     * @brief Average frame time in milliseconds.
+     */
+    qreal frameTime() const;
+
+    qreal lastFrameTime() const { return m_lastFrameTime; }
+    QStringList lastFrameReasons() const { return m_lastFrameReasons; }
+    bool isActive() const { return m_active; }
+
+    /**
+     * @brief Sampled frame times in milliseconds, oldest first.
+     */
+    Q_INVOKABLE QList<qreal> frameTimes() const;
+
+    Q_INVOKABLE void reset();
+
+signals:
+    void windowChanged();
+    void runningChanged();
+    void sampleCountChanged();
+    void idleTimeoutChanged();
+    void activeChanged();
+
+    /**
+     * @brief Emitted on the GUI thread for every frame of window.
+     */
+    void frameRendered();
+
+private:
+    void connectWindow();
+    void onFrame();
+    void setActive(bool active);
+
+    QPointer<QQuickWindow> m_window;
+    QMetaObject::Connection m_connection;
+    bool m_running = true;
+    int m_sampleCount = 60;
+    int m_idleTimeout = 250;
+
+    QElapsedTimer m_clock;
+    qint64 m_lastFrame = -1;  // ns on m_clock
+    QTimer m_idleTimer;
+
+    QList<qreal> m_samples;  // ring of frame times in ms
+    int m_sampleIndex = 0;
+    int m_frameCount = 0;
+    qreal m_lastFrameTime = 0.0;
+    QStringList m_lastFrameReasons;
+    bool m_active = false;
+};
+
+#endif // FRAMESTATS_H
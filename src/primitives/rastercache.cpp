@@ -0,0 +1,166 @@
+#include "rastercache.h"
+
+#include <QJSEngine>
+#include <QMutexLocker>
+#include <QPainter>
+#include <QQuickWindow>
+#include <QSGRendererInterface>
+
+namespace {
+
+constexpr int kDefaultCostLimit = 32 * 1024;  // KiB
+
+int imageCost(const QImage &image)
+{
+    return qMax(1, int(image.sizeInBytes() / 1024));
+}
+
+} // namespace
+
+RasterCache::RasterCache(QObject *parent)
+    : QObject(parent)
+    , m_images(kDefaultCostLimit)
+    , m_softwareBackend(QQuickWindow::graphicsApi() == QSGRendererInterface::Software)
+{
+    m_enabled = m_softwareBackend;
+}
+
+RasterCache *RasterCache::instance()
+{
+    static RasterCache *cache = new RasterCache;
+    return cache;
+}
+
+RasterCache *RasterCache::create(QQmlEngine *qmlEngine, QJSEngine *jsEngine)
+{
+    Q_UNUSED(qmlEngine)
+    Q_UNUSED(jsEngine)
+
+    // RasterPrimitive reaches the same instance from the render thread
+    RasterCache *cache = instance();
+    QJSEngine::setObjectOwnership(cache, QJSEngine::CppOwnership);
+    return cache;
+}
+
+// === Properties ===
+
+void RasterCache::setEnabled(bool enabled)
+{
+    if (m_enabled == enabled)
+        return;
+
+    m_enabled = enabled;
+    emit enabledChanged();
+}
+
+int RasterCache::costLimit() const
+{
+    QMutexLocker locker(&m_mutex);
+    return int(m_images.maxCost());
+}
+
+void RasterCache::setCostLimit(int kib)
+{
+    kib = qMax(0, kib);
+    {
+        QMutexLocker locker(&m_mutex);
+        if (m_images.maxCost() == kib)
+            return;
+        m_images.setMaxCost(kib);
+    }
+    emit costLimitChanged();
+    scheduleStatistics();
+}
+
+int RasterCache::count() const
+{
+    QMutexLocker locker(&m_mutex);
+    return int(m_images.count());
+}
+
+int RasterCache::cost() const
+{
+    QMutexLocker locker(&m_mutex);
+    return int(m_images.totalCost());
+}
+
+int RasterCache::hits() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_hits;
+}
+
+int RasterCache::misses() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_misses;
+}
+
+// === Cache ===
+
+QImage RasterCache::image(const QByteArray &key, const QSize &size, qreal devicePixelRatio,
+                          const Painter &paint)
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        if (const QImage *cached = m_images.object(key)) {
+            ++m_hits;
+            const QImage image = *cached;
+            locker.unlock();
+            scheduleStatistics();
+            return image;
+        }
+    }
+
+    // Paint outside the lock so other threads can keep hitting the cache
+    const QImage image = render(size, devicePixelRatio, paint);
+
+    {
+        QMutexLocker locker(&m_mutex);
+        ++m_misses;
+        m_images.insert(key, new QImage(image), imageCost(image));
+    }
+    scheduleStatistics();
+    return image;
+}
+
+QImage RasterCache::render(const QSize &size, qreal devicePixelRatio, const Painter &paint)
+{
+    QImage image(size * devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(devicePixelRatio);
+    image.fill(Qt::transparent);
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    paint(painter);
+    return image;
+}
+
+void RasterCache::clear()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_images.clear();
+        m_hits = 0;
+        m_misses = 0;
+    }
+    scheduleStatistics();
+}
+
+void RasterCache::scheduleStatistics()
+{
+    // Coalesce notifications; may be called from the render thread
+    {
+        QMutexLocker locker(&m_mutex);
+        if (m_statisticsPending)
+            return;
+        m_statisticsPending = true;
+    }
+
+    QMetaObject::invokeMethod(this, [this]() {
+        {
+            QMutexLocker locker(&m_mutex);
+            m_statisticsPending = false;
+        }
+        emit statisticsChanged();
+    }, Qt::QueuedConnection);
+}
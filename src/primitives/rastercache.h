@@ -0,0 +1,121 @@
+#ifndef RASTERCACHE_H
+#define RASTERCACHE_H
+
+#include <QByteArray>
+#include <QCache>
+#include <QImage>
+#include <QMutex>
+#include <QObject>
+#include <QtQml/qqmlregistration.h>
+
+#include <functional>
+
+class QPainter;
+class QQmlEngine;
+class QJSEngine;
+
+/**
+ * @brief Shared cache of CPU-rasterized primitive images.
+ *
+ * On the Qt Quick software backend, Shape paths are re-stroked with
+ * QPainter every frame and MultiEffect layers are unavailable. There the
+ * primitives switch to RasterPrimitive, which paints each distinct look
+ * once into an ARGB32_Premultiplied image (the raster engine's native
+ * format, with SIMD blend paths) and reuses it.
+ *
+ * Images are keyed by primitive kind, size and parameters, so sixty ticks
+ * of a scale share two images and a rotating needle is never repainted:
+ * its rotation is applied as an image transform. The least recently used
+ * images are evicted once costLimit is exceeded.
+ *
+ * enabled follows the backend detected at startup (QT_QUICK_BACKEND=software
+ * or QQuickWindow::setGraphicsApi(QSGRendererInterface::Software)) and can
+ * be overridden, e.g. for comparisons.
+ *
+ * @example
+ * @code
+ * Text { text: "Raster cache: " + RasterCache.count + " images, "
+ *              + RasterCache.hits + " hits" }
+ * @endcode
+ */
+class RasterCache : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_SINGLETON
+    Q_PROPERTY(bool enabled READ isEnabled WRITE setEnabled NOTIFY enabledChanged)
+    Q_PROPERTY(bool softwareBackend READ isSoftwareBackend CONSTANT)
+    Q_PROPERTY(int costLimit READ costLimit WRITE setCostLimit NOTIFY costLimitChanged)
+    Q_PROPERTY(int count READ count NOTIFY statisticsChanged)
+    Q_PROPERTY(int cost READ cost NOTIFY statisticsChanged)
+    Q_PROPERTY(int hits READ hits NOTIFY statisticsChanged)
+    Q_PROPERTY(int misses READ misses NOTIFY statisticsChanged)
+
+public:
+    using Painter = std::function<void(QPainter &painter)>;
+
+    static RasterCache *instance();
+    static RasterCache *create(QQmlEngine *qmlEngine, QJSEngine *jsEngine);
+
+    /**
+     * @brief Render primitives from cached images instead of Shapes and effects.
+     * @default softwareBackend
+     */
+    bool isEnabled() const { return m_enabled; }
+    void setEnabled(bool enabled);
+
+    /**
+     * @brief True when the scene graph runs on the software backend.
+     */
+    bool isSoftwareBackend() const { return m_softwareBackend; }
+
+    /**
+     * @brief Maximum memory held by cached images, in KiB.
+     * @default 32768
+     */
+    int costLimit() const;
+    void setCostLimit(int kib);
+
+    int count() const;
+    int cost() const;
+    int hits() const;
+    int misses() const;
+
+    /**
+     * @brief Cached image for key, painted with paint on a miss.
+     *
+     * The image is size * devicePixelRatio pixels and transparent before
+     * painting; paint draws in logical (device independent) coordinates.
+     * Thread-safe: called from the render thread during sync.
+     */
+    QImage image(const QByteArray &key, const QSize &size, qreal devicePixelRatio,
+                 const Painter &paint);
+
+    /**
+     * @brief Paint an image like image() does, without caching it. For
+     * looks that change every frame and would only evict shared images.
+     */
+    static QImage render(const QSize &size, qreal devicePixelRatio, const Painter &paint);
+
+    Q_INVOKABLE void clear();
+
+signals:
+    void enabledChanged();
+    void costLimitChanged();
+    void statisticsChanged();
+
+private:
+    explicit RasterCache(QObject *parent = nullptr);
+
+    void scheduleStatistics();
+
+    mutable QMutex m_mutex;
+    QCache<QByteArray, QImage> m_images;
+    bool m_enabled = false;
+    bool m_softwareBackend = false;
+    int m_hits = 0;
+    int m_misses = 0;
+    bool m_statisticsPending = false;
+};
+
+#endif // RASTERCACHE_H
@@ -0,0 +1,774 @@
+#include "rasterprimitive.h"
+
+#include "rastercache.h"
+
+#include <QConicalGradient>
+#include <QLinearGradient>
+#include <QPainter>
+#include <QPainterPath>
+#include <QQuickWindow>
+#include <QPainterPathStroker>
+#include <QRadialGradient>
+#include <QSGImageNode>
+#include <QSGRenderNode>
+#include <QSGRendererInterface>
+#include <QtMath>
+
+namespace {
+
+// === Parameter access ===
+
+qreal real(const QVariantMap &parameters, const char *name, qreal fallback = 0.0)
+{
+    const QVariant value = parameters.value(QLatin1String(name));
+    return value.isValid() ? value.toReal() : fallback;
+}
+
+bool flag(const QVariantMap &parameters, const char *name)
+{
+    return parameters.value(QLatin1String(name)).toBool();
+}
+
+QString text(const QVariantMap &parameters, const char *name, const QString &fallback = {})
+{
+    const QVariant value = parameters.value(QLatin1String(name));
+    return value.isValid() ? value.toString() : fallback;
+}
+
+QColor color(const QVariantMap &parameters, const char *name, const QColor &fallback = Qt::transparent)
+{
+    const QVariant value = parameters.value(QLatin1String(name));
+    return value.isValid() ? value.value<QColor>() : fallback;
+}
+
+QColor withAlpha(QColor color, qreal alpha)
+{
+    color.setAlphaF(color.alphaF() * alpha);
+    return color;
+}
+
+// Shape angles are clockwise from 3 o'clock; QPainterPath's are counter-clockwise
+QPainterPath arcPath(const QPointF &center, qreal radius, qreal startAngle, qreal sweepAngle)
+{
+    const QRectF rect(center.x() - radius, center.y() - radius, radius * 2, radius * 2);
+    QPainterPath path;
+    path.arcMoveTo(rect, -startAngle);
+    path.arcTo(rect, -startAngle, -sweepAngle);
+    return path;
+}
+
+QPainterPath polygonPath(std::initializer_list<QPointF> points)
+{
+    QPainterPath path;
+    path.addPolygon(QPolygonF(points));
+    path.closeSubpath();
+    return path;
+}
+
+// Cylinder shading across a needle part: highlight left, shadow right
+QBrush needleBrush(const QVariantMap &parameters, qreal width, bool ridge = false)
+{
+    const QColor base = color(parameters, "color");
+    if (!flag(parameters, "hasGradient"))
+        return base;
+
+    const QColor highlight = color(parameters, "gradientHighlight", base.lighter(130));
+    const QColor shadow = color(parameters, "gradientShadow", base.darker(130));
+    QLinearGradient gradient(0, 0, width, 0);
+    if (ridge) {
+        gradient.setColorAt(0.0, shadow);
+        gradient.setColorAt(0.5, highlight);
+        gradient.setColorAt(1.0, shadow);
+    } else {
+        gradient.setColorAt(0.0, highlight);
+        gradient.setColorAt(0.4, base);
+        gradient.setColorAt(1.0, shadow);
+    }
+    return gradient;
+}
+
+void fillWithBorder(QPainter &painter, const QPainterPath &path, const QBrush &brush,
+                    const QVariantMap &parameters)
+{
+    painter.fillPath(path, brush);
+
+    const qreal borderWidth = real(parameters, "borderWidth");
+    if (borderWidth > 0) {
+        QPen pen(color(parameters, "borderColor"), borderWidth);
+        pen.setJoinStyle(Qt::RoundJoin);
+        pen.setCapStyle(Qt::RoundCap);
+        painter.strokePath(path, pen);
+    }
+}
+
+// Light left edge, dark right edge
+void paintBevel(QPainter &painter, const QVariantMap &parameters, const QLineF &left, const QLineF &right)
+{
+    if (!flag(parameters, "hasBevel"))
+        return;
+
+    const QColor base = color(parameters, "color");
+    const qreal width = real(parameters, "bevelWidth", 1.0);
+    painter.setPen(QPen(color(parameters, "bevelHighlight", base.lighter(140)), width,
+                        Qt::SolidLine, Qt::RoundCap));
+    painter.drawLine(left);
+    painter.setPen(QPen(color(parameters, "bevelShadow", base.darker(140)), width,
+                        Qt::SolidLine, Qt::RoundCap));
+    painter.drawLine(right);
+}
+
+// === Painters ===
+// Each mirrors the Shape geometry of its QML primitive, in item coordinates
+
+void paintArc(QPainter &painter, const QSizeF &size, const QVariantMap &parameters)
+{
+    const qreal strokeWidth = real(parameters, "strokeWidth", 20);
+    const QPointF center(real(parameters, "centerX", size.width() / 2),
+                         real(parameters, "centerY", size.height() / 2));
+    const qreal radius = real(parameters, "radius",
+                              qMin(size.width(), size.height()) / 2 - strokeWidth / 2);
+    const qreal sweep = real(parameters, "sweepAngle", 270);
+    if (radius <= 0 || qFuzzyIsNull(sweep))
+        return;
+
+    // A full circle is a closed ring, without a cap seam
+    QPainterPath path;
+    if (qAbs(sweep) >= 360)
+        path.addEllipse(center, radius, radius);
+    else
+        path = arcPath(center, radius, real(parameters, "startAngle", -225), sweep);
+
+    const QColor fill = color(parameters, "fillColor");
+    if (fill.alpha() > 0)
+        painter.fillPath(path, fill);
+
+    const QColor stroke = color(parameters, "strokeColor");
+    if (strokeWidth > 0 && stroke.alpha() > 0) {
+        const auto cap = Qt::PenCapStyle(int(real(parameters, "capStyle", Qt::RoundCap)));
+        painter.strokePath(path, QPen(stroke, strokeWidth, Qt::SolidLine, cap));
+    }
+}
+
+void paintTick(QPainter &painter, const QSizeF &size, const QVariantMap &parameters)
+{
+    const QString shape = text(parameters, "tickShape", QStringLiteral("rectangle"));
+    const qreal width = size.width();
+    const qreal length = size.height();
+    const qreal center = width / 2;
+    const QColor base = color(parameters, "color");
+
+    const bool gradient = flag(parameters, "hasGradient");
+    const QColor gradientStart = color(parameters, "gradientStart", base);
+    const QColor gradientEnd = color(parameters, "gradientEnd", base.darker(130));
+    auto brush = [&](qreal from) -> QBrush {
+        if (!gradient)
+            return base;
+        QLinearGradient linear(0, from, 0, length);
+        linear.setColorAt(0.0, gradientStart);
+        linear.setColorAt(1.0, gradientEnd);
+        return linear;
+    };
+
+    if (shape == QLatin1String("triangle")) {
+        painter.fillPath(polygonPath({{0, 0}, {width, 0}, {center, length}}), brush(0));
+    } else if (shape == QLatin1String("rounded-dot")) {
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(gradient ? gradientStart : base);
+        painter.drawEllipse(QRectF(0, 0, width, width));
+        if (length > width)
+            painter.fillPath(polygonPath({{0, width / 2}, {width, width / 2}, {center, length}}),
+                             brush(width / 2));
+    } else if (shape == QLatin1String("chevron")) {
+        const qreal arm = width * 1.5;
+        QPen pen(base, width / 2, Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin);
+        painter.setPen(pen);
+        painter.drawPolyline(QPolygonF({{center - arm, 0}, {center, length / 2}, {center + arm, 0}}));
+    } else {
+        // rectangle, block
+        const bool block = shape == QLatin1String("block");
+        const QRectF rect(0, 0, width, length);
+        const qreal radius = !block && flag(parameters, "roundedEnds") ? qMin(width, length) / 2 : 0;
+        QPainterPath path;
+        path.addRoundedRect(rect, radius, radius);
+        painter.fillPath(path, brush(0));
+
+        if (flag(parameters, "raised")) {
+            const qreal bevel = real(parameters, "bevelWidth", 1);
+            const QColor highlight = color(parameters, "bevelHighlight", base.lighter(150));
+            const QColor shadow = color(parameters, "bevelShadow", base.darker(150));
+            const qreal highlightOpacity = real(parameters, "bevelHighlightOpacity", 0.7);
+            const qreal shadowOpacity = real(parameters, "bevelShadowOpacity", 0.5);
+
+            painter.save();
+            painter.setClipPath(path);
+            painter.fillRect(QRectF(0, 0, bevel, length), withAlpha(highlight, highlightOpacity));
+            painter.fillRect(QRectF(width - bevel, 0, bevel, length), withAlpha(shadow, shadowOpacity));
+            painter.fillRect(QRectF(0, 0, width, bevel), withAlpha(highlight, highlightOpacity * 0.7));
+            if (block)
+                painter.fillRect(QRectF(0, length - bevel, width, bevel), withAlpha(shadow, shadowOpacity * 0.7));
+            painter.restore();
+        }
+    }
+
+    if (flag(parameters, "showInnerCircle")) {
+        const qreal diameter = real(parameters, "innerCircleDiameter", width * 2);
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(color(parameters, "innerCircleColor", base));
+        painter.drawEllipse(QPointF(center, length), diameter / 2, diameter / 2);
+    }
+}
+
+void paintNeedleBody(QPainter &painter, const QVariantMap &parameters)
+{
+    const qreal length = real(parameters, "length", 100);
+    const qreal pivotWidth = real(parameters, "pivotWidth", 10);
+    const qreal tipWidth = real(parameters, "tipWidth", 4);
+    const bool rear = flag(parameters, "rear");
+    const qreal endWidth = text(parameters, "shape") == QLatin1String("straight") ? pivotWidth : tipWidth;
+    const qreal width = qMax(pivotWidth, tipWidth);
+    const qreal center = width / 2;
+
+    // Front: pivot at the bottom, tip at the top. Rear: the reverse.
+    const qreal pivotY = rear ? 0 : length;
+    const qreal endY = rear ? length : 0;
+    const QPointF pivotLeft(center - pivotWidth / 2, pivotY);
+    const QPointF pivotRight(center + pivotWidth / 2, pivotY);
+    const QPointF endLeft(center - endWidth / 2, endY);
+    const QPointF endRight(center + endWidth / 2, endY);
+
+    const bool ridge = !rear && text(parameters, "gradientStyle") == QLatin1String("ridge");
+    fillWithBorder(painter, polygonPath({pivotLeft, endLeft, endRight, pivotRight}),
+                   needleBrush(parameters, width, ridge), parameters);
+    paintBevel(painter, parameters, QLineF(pivotLeft, endLeft), QLineF(endRight, pivotRight));
+}
+
+void paintNeedleTip(QPainter &painter, const QVariantMap &parameters, bool tail)
+{
+    const QString shape = text(parameters, "shape");
+    const qreal base = real(parameters, "baseWidth", tail ? 6 : 4);
+    const qreal length = real(parameters, "length", base * (tail ? 1.5 : 2));
+    const qreal width = real(parameters, "width", base);
+    const qreal height = real(parameters, "height", length);
+    const qreal center = width / 2;
+    const QBrush brush = needleBrush(parameters, width);
+
+    if (shape == QLatin1String("flat")) {
+        // Rectangle with an inside border
+        const QRectF rect(center - base / 2, 0, base, length);
+        painter.fillRect(rect, color(parameters, "color"));
+        const qreal borderWidth = real(parameters, "borderWidth");
+        if (borderWidth > 0) {
+            painter.setPen(QPen(color(parameters, "borderColor"), borderWidth));
+            painter.setBrush(Qt::NoBrush);
+            painter.drawRect(rect.adjusted(borderWidth / 2, borderWidth / 2, -borderWidth / 2, -borderWidth / 2));
+        }
+        return;
+    }
+
+    if (!tail) {
+        if (shape == QLatin1String("pointed")) {
+            const QPointF left(center - base / 2, length), tip(center, 0), right(center + base / 2, length);
+            fillWithBorder(painter, polygonPath({left, tip, right}), brush, parameters);
+            paintBevel(painter, parameters, QLineF(left, tip), QLineF(tip, right));
+        } else if (shape == QLatin1String("rounded")) {
+            const qreal radius = base / 2;
+            QPainterPath path;
+            path.moveTo(center - radius, length);
+            path.lineTo(center - radius, radius);
+            path.arcTo(QRectF(center - radius, 0, base, base), 180, -180);
+            path.lineTo(center + radius, length);
+            path.closeSubpath();
+            fillWithBorder(painter, path, brush, parameters);
+        } else if (shape == QLatin1String("arrow")) {
+            const qreal arrowWidth = base * 1.5;
+            const qreal notch = length * 0.3;
+            fillWithBorder(painter, polygonPath({{center - base / 2, length}, {center - arrowWidth / 2, notch},
+                                                 {center, 0}, {center + arrowWidth / 2, notch},
+                                                 {center + base / 2, length}}),
+                           brush, parameters);
+        } else if (shape == QLatin1String("diamond")) {
+            const qreal diamondWidth = base * 1.2;
+            fillWithBorder(painter, polygonPath({{center - base / 2, length}, {center - diamondWidth / 2, length / 2},
+                                                 {center, 0}, {center + diamondWidth / 2, length / 2},
+                                                 {center + base / 2, length}}),
+                           brush, parameters);
+        }
+        return;
+    }
+
+    if (shape == QLatin1String("tapered")) {
+        const QPointF left(center - base / 2, 0), tip(center, length), right(center + base / 2, 0);
+        fillWithBorder(painter, polygonPath({left, tip, right}), brush, parameters);
+        paintBevel(painter, parameters, QLineF(left, tip), QLineF(tip, right));
+    } else if (shape == QLatin1String("crescent")) {
+        const qreal offset = base * real(parameters, "curveAmount", 0.5);
+        QPainterPath path;
+        path.moveTo(center - base / 2, 0);
+        path.quadTo(center - base / 2 - offset, length * 0.5, center - base * 0.3, length);
+        path.quadTo(center, length + base * 0.3, center + base * 0.3, length);
+        path.quadTo(center + base / 2 + offset, length * 0.5, center + base / 2, 0);
+        path.closeSubpath();
+        fillWithBorder(painter, path, brush, parameters);
+    } else if (shape == QLatin1String("counterweight")) {
+        const qreal radius = base * 0.75;
+        const QPointF middle(center, height / 2);
+        QBrush fill = color(parameters, "color");
+        if (flag(parameters, "hasGradient")) {
+            const QColor baseColor = color(parameters, "color");
+            QRadialGradient radial(middle, radius, middle - QPointF(base * 0.2, base * 0.2));
+            radial.setColorAt(0.0, color(parameters, "gradientHighlight", baseColor.lighter(130)));
+            radial.setColorAt(0.5, baseColor);
+            radial.setColorAt(1.0, color(parameters, "gradientShadow", baseColor.darker(130)));
+            fill = radial;
+        }
+        QPainterPath path;
+        path.addEllipse(middle, radius, radius);
+        fillWithBorder(painter, path, fill, parameters);
+    } else if (shape == QLatin1String("wedge")) {
+        const qreal wedgeWidth = base * (1 + real(parameters, "curveAmount", 0.5));
+        fillWithBorder(painter, polygonPath({{center - base / 2, 0}, {center - wedgeWidth / 2, length},
+                                             {center + wedgeWidth / 2, length}, {center + base / 2, 0}}),
+                       brush, parameters);
+    }
+}
+
+void paintBezel(QPainter &painter, const QSizeF &size, const QVariantMap &parameters)
+{
+    const qreal outer = real(parameters, "outerRadius", 200);
+    const qreal inner = real(parameters, "innerRadius", 190);
+    const QPointF center(size.width() / 2, size.height() / 2);
+    const QString style = text(parameters, "style", QStringLiteral("flat"));
+    const QColor base = color(parameters, "color");
+    const QColor highlight = color(parameters, "chromeHighlight");
+    const QColor shadow = color(parameters, "chromeShadow");
+
+    QPainterPath ring;
+    ring.setFillRule(Qt::OddEvenFill);
+    ring.addEllipse(center, outer, outer);
+    ring.addEllipse(center, inner, inner);
+
+    if (style == QLatin1String("chrome")) {
+        QLinearGradient gradient(0, center.y() - outer, 0, center.y() + outer);
+        gradient.setColorAt(0.0, highlight);
+        gradient.setColorAt(0.3, highlight.lighter(120));
+        gradient.setColorAt(0.5, base);
+        gradient.setColorAt(0.7, base.darker(120));
+        gradient.setColorAt(1.0, shadow);
+        painter.fillPath(ring, gradient);
+    } else if (style == QLatin1String("chrome3d")) {
+        const QColor midtone = color(parameters, "chrome3dMidtone", base);
+        QConicalGradient gradient(center, real(parameters, "chrome3dLightAngle", 45));
+        gradient.setColorAt(0.0, shadow);
+        gradient.setColorAt(0.1, midtone);
+        gradient.setColorAt(0.25, highlight);
+        gradient.setColorAt(0.35, highlight.lighter(130));
+        gradient.setColorAt(0.45, highlight);
+        gradient.setColorAt(0.55, midtone);
+        gradient.setColorAt(0.65, shadow);
+        gradient.setColorAt(0.75, midtone);
+        gradient.setColorAt(0.85, highlight);
+        gradient.setColorAt(0.95, midtone);
+        gradient.setColorAt(1.0, shadow);
+        painter.fillPath(ring, gradient);
+    } else {
+        painter.fillPath(ring, base);
+    }
+
+    const qreal borderWidth = real(parameters, "borderWidth");
+    if (borderWidth > 0) {
+        painter.setPen(QPen(color(parameters, "borderColor"), borderWidth));
+        painter.setBrush(Qt::NoBrush);
+        const qreal radius = inner - borderWidth / 2;
+        painter.drawEllipse(center, radius, radius);
+    }
+}
+
+void paintCenterCap(QPainter &painter, const QSizeF &size, const QVariantMap &parameters)
+{
+    const qreal diameter = real(parameters, "diameter", 20);
+    const qreal radius = diameter / 2;
+    const qreal borderWidth = real(parameters, "borderWidth", 2);
+    const QPointF center(size.width() / 2, size.height() / 2);
+    const QPointF topLeft = center - QPointF(radius, radius);
+    const QColor base = color(parameters, "color");
+    const bool domed = flag(parameters, "domed");
+
+    // Soft falloff instead of the MultiEffect drop shadow
+    if (flag(parameters, "hasShadow")) {
+        const QPointF offset(real(parameters, "shadowOffsetX", 2), real(parameters, "shadowOffsetY", 2));
+        const qreal spread = radius * (1 + real(parameters, "shadowBlur", 0.3));
+        const QColor shadow = withAlpha(color(parameters, "shadowColor", Qt::black),
+                                        real(parameters, "shadowOpacity", 0.5));
+        QRadialGradient falloff(center + offset, spread);
+        falloff.setColorAt(0.0, shadow);
+        falloff.setColorAt(radius / spread * 0.85, shadow);
+        falloff.setColorAt(1.0, Qt::transparent);
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(falloff);
+        painter.drawEllipse(center + offset, spread, spread);
+    }
+
+    // Cap body; the Rectangle border is drawn inside the bounds
+    QBrush fill = base;
+    if (domed) {
+        fill = Qt::NoBrush;
+    } else if (flag(parameters, "hasGradient")) {
+        QLinearGradient gradient(0, topLeft.y(), 0, topLeft.y() + diameter);
+        gradient.setColorAt(0.0, color(parameters, "gradientTop"));
+        gradient.setColorAt(1.0, color(parameters, "gradientBottom"));
+        fill = gradient;
+    }
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(fill);
+    painter.drawEllipse(center, radius, radius);
+
+    if (domed) {
+        const QColor midtone = color(parameters, "domedMidtoneColor", base);
+        const QPointF focal = topLeft + QPointF(diameter * real(parameters, "domedHighlightX", 0.35),
+                                                diameter * real(parameters, "domedHighlightY", 0.35));
+        QRadialGradient gradient(center, radius, focal);
+        gradient.setColorAt(0.0, color(parameters, "domedHighlightColor", base.lighter(200)));
+        gradient.setColorAt(0.3, midtone);
+        gradient.setColorAt(0.7, midtone.darker(130));
+        gradient.setColorAt(1.0, color(parameters, "domedShadowColor", base.darker(180)));
+        painter.setBrush(gradient);
+        painter.drawEllipse(center, radius - borderWidth, radius - borderWidth);
+
+        if (flag(parameters, "domedChromeReflection")) {
+            painter.strokePath(arcPath(center, diameter * 0.3, -160, 50),
+                               QPen(QColor(255, 255, 255, 153), 1.5));
+        }
+    }
+
+    if (borderWidth > 0) {
+        painter.setPen(QPen(color(parameters, "borderColor"), borderWidth));
+        painter.setBrush(Qt::NoBrush);
+        painter.drawEllipse(center, radius - borderWidth / 2, radius - borderWidth / 2);
+    }
+
+    if (flag(parameters, "hasHighlight")) {
+        const qreal width = real(parameters, "highlightWidth", borderWidth);
+        const qreal ringRadius = radius - borderWidth - width / 2;
+        painter.setPen(QPen(withAlpha(color(parameters, "highlightColor"), 0.4), width));
+        painter.setBrush(Qt::NoBrush);
+        painter.drawEllipse(center, ringRadius, ringRadius);
+    }
+}
+
+void paintGlass(QPainter &painter, const QSizeF &size, const QVariantMap &parameters)
+{
+    const QPointF center(size.width() / 2, size.height() / 2);
+    const qreal radius = real(parameters, "radius", size.width() / 2);
+
+    const qreal highlightIntensity = real(parameters, "highlightIntensity", 0.25);
+    if (flag(parameters, "highlightEnabled") && highlightIntensity > 0) {
+        const qreal angle = real(parameters, "highlightAngle", 60);
+        const QColor highlight = color(parameters, "highlightColor", Qt::white);
+
+        QPainterPath path = arcPath(center, radius - 2, -90 - angle, angle * 2);
+        const qreal inner = radius * 0.3;
+        path.lineTo(center + QPointF(qCos(qDegreesToRadians(-90 + angle)), qSin(qDegreesToRadians(-90 + angle))) * inner);
+        path.lineTo(center + QPointF(qCos(qDegreesToRadians(-90 - angle)), qSin(qDegreesToRadians(-90 - angle))) * inner);
+        path.closeSubpath();
+
+        const QPointF gradientCenter = center - QPointF(0, radius * real(parameters, "highlightOffset", 0.3));
+        QRadialGradient gradient(gradientCenter, radius * 0.8, gradientCenter - QPointF(0, radius * 0.3));
+        gradient.setColorAt(0.0, withAlpha(highlight, highlightIntensity));
+        gradient.setColorAt(0.4, withAlpha(highlight, highlightIntensity * 0.3));
+        gradient.setColorAt(1.0, Qt::transparent);
+        painter.fillPath(path, gradient);
+    }
+
+    const qreal vignetteIntensity = real(parameters, "vignetteIntensity", 0.12);
+    if (flag(parameters, "vignetteEnabled") && vignetteIntensity > 0) {
+        QRadialGradient gradient(center, radius);
+        gradient.setColorAt(qBound(0.0, real(parameters, "vignetteInnerRadius", 0.7), 1.0), Qt::transparent);
+        gradient.setColorAt(1.0, withAlpha(color(parameters, "vignetteColor", Qt::black), vignetteIntensity));
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(gradient);
+        painter.drawEllipse(center, radius, radius);
+    }
+
+    const qreal reflectionIntensity = real(parameters, "reflectionIntensity", 0.1);
+    if (flag(parameters, "reflectionEnabled") && reflectionIntensity > 0) {
+        painter.strokePath(arcPath(center, radius * 0.85, -120, 60),
+                           QPen(withAlpha(Qt::white, reflectionIntensity), 1.5));
+    }
+}
+
+// === Arc reveal ===
+
+// Software backend only: fills the outline of the visible arc with the
+// cached full-circle image, so a sweeping arc never re-rasterizes
+class ArcRevealNode : public QSGRenderNode
+{
+public:
+    explicit ArcRevealNode(QQuickWindow *window)
+        : m_window(window)
+    {
+    }
+
+    void render(const RenderState *state) override
+    {
+        QSGRendererInterface *rif = m_window->rendererInterface();
+        auto *painter = static_cast<QPainter *>(
+            rif->getResource(m_window, QSGRendererInterface::PainterResource));
+        if (!painter || m_outline.isEmpty())
+            return;
+
+        painter->save();
+        const QRegion *clipRegion = state->clipRegion();
+        if (clipRegion && !clipRegion->isEmpty())
+            painter->setClipRegion(*clipRegion, Qt::ReplaceClip);
+        painter->setTransform(matrix()->toTransform());
+        painter->setOpacity(inheritedOpacity());
+        painter->setRenderHint(QPainter::Antialiasing);
+        painter->setRenderHint(QPainter::SmoothPixmapTransform);
+        painter->fillPath(m_outline, m_brush);
+        painter->restore();
+    }
+
+    StateFlags changedStates() const override { return {}; }
+    RenderingFlags flags() const override { return BoundedRectRendering; }
+    QRectF rect() const override { return m_rect; }
+
+    void setImage(QImage image, const QRectF &rect)
+    {
+        // Texture brushes map image pixels 1:1; scale device pixels back to item units
+        const qreal devicePixelRatio = image.devicePixelRatio();
+        image.setDevicePixelRatio(1.0);
+        m_brush = QBrush(image);
+        m_brush.setTransform(QTransform::fromTranslate(rect.x(), rect.y())
+                                 .scale(1.0 / devicePixelRatio, 1.0 / devicePixelRatio));
+        m_rect = rect;
+    }
+
+    void setOutline(const QPainterPath &outline) { m_outline = outline; }
+
+private:
+    QQuickWindow *m_window;
+    QBrush m_brush;
+    QRectF m_rect;
+    QPainterPath m_outline;
+};
+
+// Outline of the stroked arc. One pixel wider than the stroke on each side,
+// so the ring image's own antialiased edges are not attenuated twice.
+QPainterPath revealOutline(const QSizeF &size, const QVariantMap &parameters, qreal sweep)
+{
+    const qreal strokeWidth = real(parameters, "strokeWidth", 20);
+    const QPointF center(real(parameters, "centerX", size.width() / 2),
+                         real(parameters, "centerY", size.height() / 2));
+    const qreal radius = real(parameters, "radius",
+                              qMin(size.width(), size.height()) / 2 - strokeWidth / 2);
+    if (radius <= 0 || strokeWidth <= 0 || qFuzzyIsNull(sweep))
+        return {};
+
+    QPainterPathStroker stroker;
+    stroker.setWidth(strokeWidth + 2);
+    stroker.setCapStyle(Qt::PenCapStyle(int(real(parameters, "capStyle", Qt::RoundCap))));
+    return stroker.createStroke(arcPath(center, radius, real(parameters, "startAngle", -225),
+                                        qBound(-360.0, sweep, 360.0)));
+}
+
+} // namespace
+
+RasterPrimitive::RasterPrimitive(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+    setFlag(ItemHasContents, true);
+    connect(RasterCache::instance(), &RasterCache::enabledChanged, this, &QQuickItem::update);
+}
+
+// === Properties ===
+
+void RasterPrimitive::setKind(Kind kind)
+{
+    if (m_kind == kind)
+        return;
+
+    m_kind = kind;
+    update();
+    emit kindChanged();
+}
+
+void RasterPrimitive::setParameters(const QVariantMap &parameters)
+{
+    if (m_parameters == parameters)
+        return;
+
+    m_parameters = parameters;
+    update();
+    emit parametersChanged();
+}
+
+void RasterPrimitive::setMargin(qreal margin)
+{
+    margin = qMax(0.0, margin);
+    if (qFuzzyCompare(m_margin, margin))
+        return;
+
+    m_margin = margin;
+    update();
+    emit marginChanged();
+}
+
+void RasterPrimitive::setRevealAngle(qreal angle)
+{
+    if (qFuzzyCompare(m_revealAngle, angle))
+        return;
+
+    m_revealAngle = angle;
+    if (m_kind == Arc)
+        update();
+    emit revealAngleChanged();
+}
+
+void RasterPrimitive::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size())
+        update();
+}
+
+void RasterPrimitive::itemChange(ItemChange change, const ItemChangeData &data)
+{
+    QQuickItem::itemChange(change, data);
+    if (change == ItemDevicePixelRatioHasChanged || change == ItemSceneChange)
+        update();
+}
+
+// === Scene graph ===
+
+QByteArray RasterPrimitive::cacheKey(const QVariantMap &parameters, const QSize &size,
+                                     qreal devicePixelRatio) const
+{
+    QByteArray key;
+    key.reserve(256);
+    key += QByteArray::number(int(m_kind));
+    key += '|';
+    key += QByteArray::number(size.width());
+    key += 'x';
+    key += QByteArray::number(size.height());
+    key += '@';
+    key += QByteArray::number(devicePixelRatio);
+    key += '+';
+    key += QByteArray::number(m_margin, 'g', 4);
+
+    // QVariantMap iterates in key order, so equal maps give equal keys
+    for (auto it = parameters.cbegin(); it != parameters.cend(); ++it) {
+        key += '|';
+        key += it.key().toUtf8();
+        key += '=';
+        const QVariant &value = it.value();
+        if (value.typeId() == QMetaType::QColor)
+            key += value.value<QColor>().name(QColor::HexArgb).toLatin1();
+        else if (value.typeId() == QMetaType::Double || value.typeId() == QMetaType::Float)
+            key += QByteArray::number(value.toDouble(), 'g', 6);
+        else
+            key += value.toString().toUtf8();
+    }
+    return key;
+}
+
+QImage RasterPrimitive::rasterize(const QVariantMap &parameters, const QSize &size,
+                                  QQuickWindow *window, bool cached) const
+{
+    const qreal devicePixelRatio = window->effectiveDevicePixelRatio();
+    const QSizeF itemSize = boundingRect().size();
+    const RasterCache::Painter paint = [&](QPainter &painter) {
+        painter.translate(m_margin, m_margin);
+        switch (m_kind) {
+        case Arc: paintArc(painter, itemSize, parameters); break;
+        case Tick: paintTick(painter, itemSize, parameters); break;
+        case NeedleBody: paintNeedleBody(painter, parameters); break;
+        case NeedleHeadTip: paintNeedleTip(painter, parameters, false); break;
+        case NeedleTailTip: paintNeedleTip(painter, parameters, true); break;
+        case Bezel: paintBezel(painter, itemSize, parameters); break;
+        case CenterCap: paintCenterCap(painter, itemSize, parameters); break;
+        case Glass: paintGlass(painter, itemSize, parameters); break;
+        }
+    };
+
+    if (!cached)
+        return RasterCache::render(size, devicePixelRatio, paint);
+    return RasterCache::instance()->image(cacheKey(parameters, size, devicePixelRatio), size,
+                                          devicePixelRatio, paint);
+}
+
+QSGNode *RasterPrimitive::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data)
+{
+    Q_UNUSED(data)
+
+    QQuickWindow *win = window();
+    if (!RasterCache::instance()->isEnabled() || !win || width() <= 0 || height() <= 0) {
+        delete oldNode;
+        m_nodeKey.clear();
+        return nullptr;
+    }
+
+    const QRectF rect = boundingRect().adjusted(-m_margin, -m_margin, m_margin, m_margin);
+    const QSize size(qCeil(rect.width()), qCeil(rect.height()));
+
+    // A filled arc is not part of the ring image; bake its sweep instead
+    const bool reveal = m_kind == Arc
+        && win->rendererInterface()->graphicsApi() == QSGRendererInterface::Software
+        && color(m_parameters, "fillColor").alpha() == 0;
+    if (reveal != m_revealNode) {
+        delete oldNode;
+        oldNode = nullptr;
+        m_revealNode = reveal;
+    }
+    if (reveal)
+        return updateArcRevealNode(oldNode, rect, size);
+
+    auto *node = static_cast<QSGImageNode *>(oldNode);
+    if (!node) {
+        node = win->createImageNode();
+        node->setOwnsTexture(true);
+        node->setFiltering(QSGTexture::Linear);
+        m_nodeKey.clear();
+    }
+
+    // Without the reveal node an arc bakes its sweep. Each sweep is a
+    // full-size image used for one animation step, so it stays out of the
+    // cache; quarter-degree steps skip re-painting sub-pixel changes.
+    QVariantMap parameters = m_parameters;
+    if (m_kind == Arc)
+        parameters.insert(QStringLiteral("sweepAngle"), qRound(m_revealAngle * 4) / 4.0);
+
+    const QByteArray key = cacheKey(parameters, size, win->effectiveDevicePixelRatio());
+    if (key != m_nodeKey) {
+        // The node owns its texture and releases the previous one
+        const QImage image = rasterize(parameters, size, win, m_kind != Arc);
+        node->setTexture(win->createTextureFromImage(image));
+        m_nodeKey = key;
+    }
+
+    node->setRect(rect);
+    return node;
+}
+
+QSGNode *RasterPrimitive::updateArcRevealNode(QSGNode *oldNode, const QRectF &rect,
+                                              const QSize &size)
+{
+    QQuickWindow *win = window();
+    auto *node = static_cast<ArcRevealNode *>(oldNode);
+    if (!node) {
+        node = new ArcRevealNode(win);
+        m_nodeKey.clear();
+    }
+
+    // The ring is the same for every sweep; only the outline follows revealAngle
+    QVariantMap ring = m_parameters;
+    ring.insert(QStringLiteral("sweepAngle"), 360.0);
+    const QByteArray key = cacheKey(ring, size, win->effectiveDevicePixelRatio());
+    if (key != m_nodeKey) {
+        node->setImage(rasterize(ring, size, win), rect);
+        m_nodeKey = key;
+    }
+
+    node->setOutline(revealOutline(boundingRect().size(), m_parameters, m_revealAngle));
+    node->markDirty(QSGNode::DirtyMaterial);
+    return node;
+}
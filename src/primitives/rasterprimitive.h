@@ -0,0 +1,123 @@
+#ifndef RASTERPRIMITIVE_H
+#define RASTERPRIMITIVE_H
+
+#include <QByteArray>
+#include <QImage>
+#include <QQuickItem>
+#include <QVariantMap>
+#include <QtQml/qqmlregistration.h>
+
+/**
+ * @brief Primitive drawn from a cached, CPU-rasterized image.
+ *
+ * The software-backend fast path of the gauge primitives. Each primitive
+ * (GaugeArc, GaugeTick, the needle parts, GaugeBezel, GaugeCenterCap,
+ * GlassOverlay) loads one instead of its Shapes and effects while
+ * RasterCache.enabled is true; with the cache off it is not instantiated.
+ *
+ * kind selects the painter and parameters carries the primitive's visual
+ * properties under the primitive's own property names. The image is
+ * painted once per distinct kind, size and parameters (see RasterCache)
+ * and shown as a single textured node; transforms on the item or its
+ * ancestors (needle rotation, tick placement) are applied to the image.
+ *
+ * Only visual changes re-rasterize. Effects that need an offscreen pass
+ * are approximated: shadows become soft radial falloffs and glows are
+ * dropped.
+ *
+ * An Arc is rasterized as the full circle and revealAngle selects how much
+ * of it is shown, so a sweeping value arc uses one image for every angle.
+ * On the software backend the ring is painted through the outline of the
+ * visible arc; elsewhere the sweep is baked in quarter-degree steps into
+ * uncached images, so it never evicts the shared ones.
+ *
+ * @example
+ * @code
+ * Loader {
+ *     anchors.fill: parent
+ *     active: RasterCache.enabled
+ *     sourceComponent: RasterPrimitive {
+ *         kind: RasterPrimitive.CenterCap
+ *         parameters: ({ diameter: root.diameter, color: root.color, domed: true })
+ *     }
+ * }
+ * @endcode
+ */
+class RasterPrimitive : public QQuickItem
+{
+    Q_OBJECT
+    QML_ELEMENT
+    Q_PROPERTY(Kind kind READ kind WRITE setKind NOTIFY kindChanged)
+    Q_PROPERTY(QVariantMap parameters READ parameters WRITE setParameters NOTIFY parametersChanged)
+    Q_PROPERTY(qreal margin READ margin WRITE setMargin NOTIFY marginChanged)
+    Q_PROPERTY(qreal revealAngle READ revealAngle WRITE setRevealAngle NOTIFY revealAngleChanged)
+
+public:
+    enum Kind {
+        Arc,
+        Tick,
+        NeedleBody,
+        NeedleHeadTip,
+        NeedleTailTip,
+        Bezel,
+        CenterCap,
+        Glass
+    };
+    Q_ENUM(Kind)
+
+    explicit RasterPrimitive(QQuickItem *parent = nullptr);
+
+    Kind kind() const { return m_kind; }
+    void setKind(Kind kind);
+
+    /**
+     * @brief Visual properties of the primitive, e.g. { color: "red", length: 80 }.
+     */
+    QVariantMap parameters() const { return m_parameters; }
+    void setParameters(const QVariantMap &parameters);
+
+    /**
+     * @brief Extra pixels painted around the item bounds, for strokes,
+     * caps and shadows that extend past the primitive's geometry.
+     * @default 0
+     */
+    qreal margin() const { return m_margin; }
+    void setMargin(qreal margin);
+
+    /**
+     * @brief Arc only: degrees of the arc shown from parameters.startAngle.
+     * Changing it does not re-rasterize.
+     * @default 0
+     */
+    qreal revealAngle() const { return m_revealAngle; }
+    void setRevealAngle(qreal angle);
+
+signals:
+    void kindChanged();
+    void parametersChanged();
+    void marginChanged();
+    void revealAngleChanged();
+
+protected:
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void itemChange(ItemChange change, const ItemChangeData &data) override;
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) override;
+
+private:
+    QByteArray cacheKey(const QVariantMap &parameters, const QSize &size,
+                        qreal devicePixelRatio) const;
+    QImage rasterize(const QVariantMap &parameters, const QSize &size,
+                     QQuickWindow *window, bool cached = true) const;
+    QSGNode *updateArcRevealNode(QSGNode *oldNode, const QRectF &rect, const QSize &size);
+
+    Kind m_kind = Arc;
+    QVariantMap m_parameters;
+    qreal m_margin = 0.0;
+    qreal m_revealAngle = 0.0;
+
+    // Key of the image currently in the node; only a new key re-textures
+    QByteArray m_nodeKey;
+    bool m_revealNode = false;
+};
+
+#endif // RASTERPRIMITIVE_H
@@ -1,4 +1,5 @@
 import QtQuick
+import DevDash.Gauges 1.0
 import DevDash.Gauges.Primitives 1.0
 import DevDash.Gauges.Compounds 1.0
 
@@ -11,14 +12,19 @@ import DevDash.Gauges.Compounds 1.0
  * Includes (all toggleable):
  * - Background face
  * - Background arc track
- * - Zone arcs (redline, warning)
+ * - Zone arcs (redline, warning, multi-band zones)
  * - Tick marks and labels
  * - Value arc (fills to current value)
  * - Animated needle
+ * - Peak marker (highest recent value)
  * - Center cap
  * - Digital readout
  * - Decorative bezel
  *
+ * Colors default to the active GaugeTheme (see GaugeThemes.current). Set
+ * GaugeTheme.theme on the gauge or an ancestor to theme a subset, or assign
+ * a color property directly to pin that one color.
+ *
  * @example
  * @code
  * AnalogGauge {
@@ -73,6 +79,16 @@ Item {
      */
     property real redlineStart: maxValue
 
+    /**
+     * @brief Colored bands along the track, as {from, to, color[, endColor]}.
+     *
+     * Drawn by one MultiZoneArc under the redline zone, for gauges like
+     * coolant or AFR with several ranges and gradient transitions.
+     *
+     * @default [] (no bands)
+     */
+    property var zones: []
+
     // === Geometry Properties ===
 
     /**
@@ -134,6 +150,84 @@ Item {
      */
     property bool showBezel: false
 
+    /**
+     * @brief Show a marker at peakValue outside the tick ring.
+     */
+    property bool showPeak: false
+
+    // === Peak Marker ===
+
+    /**
+     * @brief Value the peak marker points at.
+     *
+     * Defaults to the peak of an internal ValueHistory fed by value, held
+     * for peakHoldTime. Bind it to a shared ValueHistory's peak (or any
+     * other value) to drive the marker externally.
+     *
+     * @default internal history peak
+     */
+    property real peakValue: peakHistory.peak
+
+    /**
+     * @brief Time in ms the internal peak is held before dropping to value.
+     * @default 2000
+     */
+    property int peakHoldTime: 2000
+
+    /**
+     * @brief Peak marker color.
+     * @default warningColor
+     */
+    property color peakColor: warningColor
+
+    // === Alerts ===
+
+    /**
+     * @brief Current alert level: GaugeAlert.Normal, Warning or Critical.
+     *
+     * Reached at warningThreshold and redlineStart. Drives the value arc
+     * and readout colors.
+     */
+    readonly property int alertLevel: alert.level
+
+    /**
+     * @brief Distance below a threshold the value must fall to clear its alert.
+     * @default 0
+     */
+    property real alertHysteresis: 0
+
+    /**
+     * @brief Time in ms a new alert level must persist before it is shown.
+     * @default 0
+     */
+    property int alertDwellTime: 0
+
+    /**
+     * @brief Flash the redline zone and readout while critical.
+     *
+     * Flashing follows the shared GaugeAlerts clock, so every flashing
+     * gauge is in phase.
+     *
+     * @default false
+     */
+    property bool flashRedline: false
+
+    /**
+     * @brief GaugeAlert.Blink or GaugeAlert.Pulse.
+     * @default GaugeAlert.Blink
+     */
+    property int flashStyle: GaugeAlert.Blink
+
+    // === Rendering ===
+
+    /**
+     * @brief True while nothing in the gauge is moving.
+     *
+     * A settled gauge renders no frames until its value visibly changes.
+     * Set objectName to see this gauge by name in FrameActivity.
+     */
+    readonly property bool settled: needle.settled && valueArc.settled && !alert.flashing
+
     // === Tick Configuration ===
 
     /**
@@ -152,16 +246,24 @@ Item {
     property real labelDivisor: 1
 
     // === Color Scheme ===
+    // Bound to the effective theme; theme switches arrive as one batched,
+    // already-interpolated update per frame
 
-    property color faceColor: "#1a1a1a"
-    property color bezelColor: "#2a2a2a"
-    property color backgroundArcColor: "#333333"
-    property color valueArcColor: "#00aaff"
-    property color needleColor: "#ffffff"
-    property color tickColor: "#888888"
-    property color redlineColor: "#aa2222"
-    property color warningColor: "#ffaa00"
-    property color criticalColor: "#ff4444"
+    property color faceColor: GaugeTheme.faceColor
+    property color bezelColor: GaugeTheme.bezelColor
+    property color backgroundArcColor: GaugeTheme.backgroundArcColor
+    property color valueArcColor: GaugeTheme.valueArcColor
+    property color needleColor: GaugeTheme.needleColor
+    property color tickColor: GaugeTheme.tickColor
+    property color redlineColor: GaugeTheme.redlineColor
+    property color warningColor: GaugeTheme.warningColor
+    property color criticalColor: GaugeTheme.criticalColor
+
+    /**
+     * @brief Color of the digital readout value.
+     * @default GaugeTheme.textColor ("#ffffff")
+     */
+    property color textColor: GaugeTheme.textColor
 
     // === Needle Customization ===
 
@@ -470,6 +572,46 @@ Item {
         return root.startAngle + (root.sweepAngle * clamped)
     }
 
+    readonly property real _peakAngle: {
+        const norm = (root.peakValue - root.minValue) / (root.maxValue - root.minValue)
+        const clamped = Math.max(0, Math.min(1, norm))
+        return root.startAngle + (root.sweepAngle * clamped)
+    }
+
+    // Only records while the marker is shown and nothing overrides peakValue
+    ValueHistory {
+        id: peakHistory
+        value: root.value
+        recording: root.showPeak
+        capacity: 2
+        peakHoldTime: root.peakHoldTime
+    }
+
+    onShowPeakChanged: if (showPeak) peakHistory.resetPeak()
+
+    // One-shot repaints are only reported while FrameActivity traces them
+    Connections {
+        target: root
+        enabled: FrameActivity.tracing
+        function onValueChanged() { FrameActivity.request(root, "value") }
+    }
+
+    GaugeAlert {
+        id: alert
+        value: root.value
+        warningThreshold: root.warningThreshold
+        criticalThreshold: root.redlineStart
+        hysteresis: root.alertHysteresis
+        dwellTime: root.alertDwellTime
+        flashLevel: root.flashRedline ? GaugeAlert.Critical : GaugeAlert.Normal
+        flashStyle: root.flashStyle
+    }
+
+    FrameSource {
+        active: alert.flashing
+        reason: "alert flashing"
+    }
+
     // Layer 1: Background face
     GaugeFace {
         anchors.centerIn: parent
@@ -489,7 +631,18 @@ Item {
         animated: false
     }
 
-    // Layer 3: Redline zone arc
+    // Layer 3: Zone bands and redline zone arc
+    MultiZoneArc {
+        anchors.fill: parent
+        visible: root.zones.length > 0
+        bands: root.zones
+        minValue: root.minValue
+        maxValue: root.maxValue
+        gaugeStartAngle: root.startAngle
+        gaugeTotalSweep: root.sweepAngle
+        strokeWidth: 20
+    }
+
     GaugeZoneArc {
         anchors.fill: parent
         visible: root.showRedline && root.redlineStart < root.maxValue
@@ -500,7 +653,7 @@ Item {
         gaugeStartAngle: root.startAngle
         gaugeTotalSweep: root.sweepAngle
         zoneColor: root.redlineColor
-        zoneOpacity: 0.3
+        zoneOpacity: alert.flashing ? 0.3 + 0.6 * alert.pulse : 0.3
         strokeWidth: 20
     }
 
@@ -546,6 +699,7 @@ Item {
 
     // Layer 5: Value arc
     GaugeValueArc {
+        id: valueArc
         anchors.fill: parent
         visible: root.showValueArc
         value: root.value
@@ -555,14 +709,31 @@ Item {
         totalSweepAngle: root.sweepAngle
         warningThreshold: root.warningThreshold
         criticalThreshold: root.redlineStart
+        alertLevel: alert.level
         normalColor: root.valueArcColor
         warningColor: root.warningColor
         criticalColor: root.criticalColor
         strokeWidth: 22
+
+        // Theme transitions already step the colors on the shared clock
+        colorAnimated: !GaugeThemes.transitioning
+    }
+
+    // Layer 5b: Peak marker (pointing inward, just outside the tick ring)
+    GaugeTick {
+        anchors.centerIn: parent
+        visible: root.showPeak
+        angle: root._peakAngle
+        distanceFromCenter: Math.min(root.width, root.height) / 2 - 44
+        length: 14
+        tickWidth: 10
+        tickShape: "triangle"
+        color: root.peakColor
     }
 
     // Layer 6: Needle
     GaugeNeedle {
+        id: needle
         anchors.fill: parent
         visible: root.showNeedle
 
@@ -641,9 +812,16 @@ Item {
         value: root.value
         unit: root.unit
         precision: 0
+        integerDigits: Math.floor(Math.log10(Math.max(Math.abs(root.minValue), Math.abs(root.maxValue), 1))) + 1
         valueFontSize: 32
         warningThreshold: root.warningThreshold
         criticalThreshold: root.redlineStart
+        alertLevel: alert.level
+        flashOn: alert.flashOn
+        normalColor: root.textColor
+        warningColor: root.warningColor
+        criticalColor: root.criticalColor
+        colorAnimated: !GaugeThemes.transitioning
     }
 
     // Layer 9: Label (bottom)
@@ -364,6 +364,7 @@ Item {
         value: root.value
         unit: root.unit
         precision: 0
+        integerDigits: Math.floor(Math.log10(Math.max(Math.abs(root.minValue), Math.abs(root.maxValue), 1))) + 1
         valueFontSize: 28
         warningThreshold: root.warningThreshold
         criticalThreshold: root.redlineStart
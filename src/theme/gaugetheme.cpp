@@ -0,0 +1,332 @@
+#include "gaugetheme.h"
+
+#include <QAbstractAnimation>
+#include <QEasingCurve>
+#include <QJSEngine>
+#include <QMetaObject>
+#include <QQmlEngine>
+#include <QQuickItem>
+
+namespace {
+
+QColor mixColor(const QColor &from, const QColor &to, float progress)
+{
+    const QColor a = from.toRgb();
+    const QColor b = to.toRgb();
+    return QColor::fromRgbF(a.redF() + (b.redF() - a.redF()) * progress,
+                            a.greenF() + (b.greenF() - a.greenF()) * progress,
+                            a.blueF() + (b.blueF() - a.blueF()) * progress,
+                            a.alphaF() + (b.alphaF() - a.alphaF()) * progress);
+}
+
+// Visual parent for items, QObject parent for everything else
+QObject *themeParentOf(QObject *object)
+{
+    if (auto *item = qobject_cast<QQuickItem *>(object)) {
+        if (item->parentItem())
+            return item->parentItem();
+    }
+    return object->parent();
+}
+
+} // namespace
+
+// === GaugeTheme ===
+
+GaugeTheme::GaugeTheme(QObject *parent)
+    : QObject(parent)
+{
+    // The library's historical dark palette (RadialGauge defaults)
+    m_palette[Face] = QColor(0x1a, 0x1a, 0x1a);
+    m_palette[Bezel] = QColor(0x2a, 0x2a, 0x2a);
+    m_palette[BackgroundArc] = QColor(0x33, 0x33, 0x33);
+    m_palette[ValueArc] = QColor(0x00, 0xaa, 0xff);
+    m_palette[Needle] = QColor(0xff, 0xff, 0xff);
+    m_palette[Tick] = QColor(0x88, 0x88, 0x88);
+    m_palette[Text] = QColor(0xff, 0xff, 0xff);
+    m_palette[Redline] = QColor(0xaa, 0x22, 0x22);
+    m_palette[Warning] = QColor(0xff, 0xaa, 0x00);
+    m_palette[Critical] = QColor(0xff, 0x44, 0x44);
+}
+
+void GaugeTheme::setColor(Role role, const QColor &color)
+{
+    if (m_palette[role] == color)
+        return;
+
+    m_palette[role] = color;
+    emit paletteChanged();
+
+    // Gauges pick the change up in the next flush, together with any
+    // other color changes made in the same pass
+    GaugeThemes::instance()->scheduleFlush();
+}
+
+void GaugeTheme::setTransitionDuration(int duration)
+{
+    duration = qMax(0, duration);
+    if (m_transitionDuration == duration)
+        return;
+
+    m_transitionDuration = duration;
+    emit transitionDurationChanged();
+}
+
+GaugeThemeAttached *GaugeTheme::qmlAttachedProperties(QObject *object)
+{
+    return new GaugeThemeAttached(object);
+}
+
+// === GaugeThemeAttached ===
+
+GaugeThemeAttached::GaugeThemeAttached(QObject *parent)
+    : QObject(parent)
+{
+    // Start from the global theme so the first binding evaluation already
+    // has real colors. Overrides set during creation are picked up by the
+    // first flush, which snaps instead of transitioning.
+    m_current = GaugeThemes::instance()->current()->palette();
+    m_to = m_current;
+
+    if (auto *item = qobject_cast<QQuickItem *>(parent)) {
+        connect(item, &QQuickItem::parentChanged,
+                GaugeThemes::instance(), &GaugeThemes::scheduleFlush);
+    }
+
+    GaugeThemes::instance()->registerAttached(this);
+}
+
+GaugeThemeAttached::~GaugeThemeAttached()
+{
+    GaugeThemes::instance()->unregisterAttached(this);
+}
+
+void GaugeThemeAttached::setTheme(GaugeTheme *theme)
+{
+    if (m_theme == theme)
+        return;
+
+    if (m_theme)
+        disconnect(m_theme, &QObject::destroyed, GaugeThemes::instance(), nullptr);
+    m_theme = theme;
+    if (m_theme) {
+        connect(m_theme, &QObject::destroyed,
+                GaugeThemes::instance(), &GaugeThemes::scheduleFlush);
+    }
+
+    emit themeChanged();
+
+    // Overrides apply to the whole subtree, so every gauge is re-resolved
+    GaugeThemes::instance()->scheduleFlush();
+}
+
+QColor GaugeThemeAttached::faceColor() const { return m_current[GaugeTheme::Face]; }
+QColor GaugeThemeAttached::bezelColor() const { return m_current[GaugeTheme::Bezel]; }
+QColor GaugeThemeAttached::backgroundArcColor() const { return m_current[GaugeTheme::BackgroundArc]; }
+QColor GaugeThemeAttached::valueArcColor() const { return m_current[GaugeTheme::ValueArc]; }
+QColor GaugeThemeAttached::needleColor() const { return m_current[GaugeTheme::Needle]; }
+QColor GaugeThemeAttached::tickColor() const { return m_current[GaugeTheme::Tick]; }
+QColor GaugeThemeAttached::textColor() const { return m_current[GaugeTheme::Text]; }
+QColor GaugeThemeAttached::redlineColor() const { return m_current[GaugeTheme::Redline]; }
+QColor GaugeThemeAttached::warningColor() const { return m_current[GaugeTheme::Warning]; }
+QColor GaugeThemeAttached::criticalColor() const { return m_current[GaugeTheme::Critical]; }
+
+GaugeTheme *GaugeThemeAttached::resolveTheme() const
+{
+    if (m_theme)
+        return m_theme;
+
+    for (QObject *ancestor = themeParentOf(parent()); ancestor; ancestor = themeParentOf(ancestor)) {
+        auto *attached = qobject_cast<GaugeThemeAttached *>(
+            qmlAttachedPropertiesObject<GaugeTheme>(ancestor, false));
+        if (attached && attached->m_theme)
+            return attached->m_theme;
+    }
+
+    return GaugeThemes::instance()->current();
+}
+
+bool GaugeThemeAttached::retarget(int now)
+{
+    const GaugeTheme *theme = resolveTheme();
+    const GaugeTheme::Palette &target = theme->palette();
+
+    if (!m_initialized || theme->transitionDuration() == 0) {
+        m_initialized = true;
+        m_transitioning = false;
+        m_to = target;
+        if (m_current != target) {
+            m_current = target;
+            emit paletteChanged();
+        }
+        return false;
+    }
+
+    if (target == m_to)
+        return m_transitioning;
+
+    // Start from whatever is on screen, including a half-finished transition
+    m_from = m_current;
+    m_to = target;
+    m_transitionStart = now;
+    m_transitionDuration = theme->transitionDuration();
+    m_transitioning = true;
+    return true;
+}
+
+bool GaugeThemeAttached::advance(int now)
+{
+    if (!m_transitioning)
+        return false;
+
+    static const QEasingCurve easing(QEasingCurve::InOutQuad);
+    const qreal progress = qreal(now - m_transitionStart) / m_transitionDuration;
+
+    if (progress >= 1.0) {
+        m_current = m_to;
+        m_transitioning = false;
+    } else {
+        const float eased = float(easing.valueForProgress(qMax(0.0, progress)));
+        for (int role = 0; role < GaugeTheme::RoleCount; ++role)
+            m_current[role] = mixColor(m_from[role], m_to[role], eased);
+    }
+
+    emit paletteChanged();
+    return m_transitioning;
+}
+
+// === GaugeThemes ===
+
+/**
+ * @brief Shared animation clock for all theme transitions.
+ *
+ * Driven by the Qt Quick animation driver, so transitions advance in step
+ * with rendering (and with QTest's controlled time in tests).
+ */
+class GaugeThemes::Clock : public QAbstractAnimation
+{
+public:
+    explicit Clock(GaugeThemes *themes)
+        : QAbstractAnimation(themes)
+        , m_themes(themes)
+    {
+    }
+
+    int duration() const override { return -1; }
+
+protected:
+    void updateCurrentTime(int currentTime) override { m_themes->tick(currentTime); }
+
+private:
+    GaugeThemes *m_themes;
+};
+
+GaugeThemes::GaugeThemes(QObject *parent)
+    : QObject(parent)
+    , m_defaultTheme(new GaugeTheme(this))
+    , m_clock(new Clock(this))
+{
+}
+
+GaugeThemes *GaugeThemes::instance()
+{
+    static GaugeThemes *themes = new GaugeThemes;
+    return themes;
+}
+
+GaugeThemes *GaugeThemes::create(QQmlEngine *qmlEngine, QJSEngine *jsEngine)
+{
+    Q_UNUSED(qmlEngine)
+    Q_UNUSED(jsEngine)
+
+    // Attached objects reach the same instance from C++, so QML must not own it
+    GaugeThemes *themes = instance();
+    QJSEngine::setObjectOwnership(themes, QJSEngine::CppOwnership);
+    return themes;
+}
+
+GaugeTheme *GaugeThemes::current() const
+{
+    return m_current ? m_current.data() : m_defaultTheme;
+}
+
+void GaugeThemes::setCurrent(GaugeTheme *theme)
+{
+    if (m_current == theme)
+        return;
+
+    if (m_current)
+        disconnect(m_current, &QObject::destroyed, this, nullptr);
+    m_current = theme;
+    if (m_current)
+        connect(m_current, &QObject::destroyed, this, &GaugeThemes::scheduleFlush);
+
+    emit currentChanged();
+    scheduleFlush();
+}
+
+void GaugeThemes::scheduleFlush()
+{
+    if (m_flushPending)
+        return;
+
+    m_flushPending = true;
+    QMetaObject::invokeMethod(this, &GaugeThemes::flush, Qt::QueuedConnection);
+}
+
+void GaugeThemes::registerAttached(GaugeThemeAttached *attached)
+{
+    m_attached.insert(attached);
+    scheduleFlush();
+}
+
+void GaugeThemes::unregisterAttached(GaugeThemeAttached *attached)
+{
+    m_attached.remove(attached);
+    if (m_transitioning.remove(attached) && m_transitioning.isEmpty()) {
+        m_clock->stop();
+        emit transitioningChanged();
+    }
+}
+
+void GaugeThemes::flush()
+{
+    m_flushPending = false;
+
+    const bool wasTransitioning = isTransitioning();
+    const bool clockRunning = m_clock->state() == QAbstractAnimation::Running;
+    const int now = clockRunning ? m_clock->currentTime() : 0;
+
+    // Bindings reacting to paletteChanged may create or destroy gauges
+    const QList<GaugeThemeAttached *> attachedObjects = m_attached.values();
+    for (GaugeThemeAttached *attached : attachedObjects) {
+        if (!m_attached.contains(attached))
+            continue;
+        if (attached->retarget(now))
+            m_transitioning.insert(attached);
+        else
+            m_transitioning.remove(attached);
+    }
+
+    if (!m_transitioning.isEmpty() && !clockRunning)
+        m_clock->start();
+    else if (m_transitioning.isEmpty() && clockRunning)
+        m_clock->stop();
+
+    if (wasTransitioning != isTransitioning())
+        emit transitioningChanged();
+}
+
+void GaugeThemes::tick(int now)
+{
+    const QList<GaugeThemeAttached *> active = m_transitioning.values();
+    for (GaugeThemeAttached *attached : active) {
+        if (m_transitioning.contains(attached) && !attached->advance(now))
+            m_transitioning.remove(attached);
+    }
+
+    if (m_transitioning.isEmpty() && m_clock->state() == QAbstractAnimation::Running) {
+        m_clock->stop();
+        emit transitioningChanged();
+    }
+}
@@ -0,0 +1,251 @@
+#ifndef GAUGETHEME_H
+#define GAUGETHEME_H
+
+#include <QColor>
+#include <QObject>
+#include <QPointer>
+#include <QSet>
+#include <QtQml/qqmlregistration.h>
+
+#include <array>
+
+class GaugeThemeAttached;
+class GaugeThemes;
+class QQmlEngine;
+class QJSEngine;
+
+/**
+ * @brief A gauge color palette.
+ *
+ * Create GaugeTheme objects for each look (day, night, racing...) and make
+ * one current with GaugeThemes.current, or scope one to a subtree with the
+ * GaugeTheme.theme attached property.
+ *
+ * Changes are not pushed to gauges immediately. Any number of color or
+ * theme changes made in the same event loop pass are coalesced into one
+ * transaction, and the resulting color transitions for every gauge run
+ * from the single GaugeThemes clock.
+ *
+ * @example
+ * @code
+ * GaugeTheme {
+ *     id: nightTheme
+ *     faceColor: "#000000"
+ *     tickColor: "#aa4400"
+ *     needleColor: "#ff3300"
+ *     transitionDuration: 400
+ * }
+ *
+ * Switch { onToggled: GaugeThemes.current = checked ? nightTheme : GaugeThemes.defaultTheme }
+ * @endcode
+ */
+class GaugeTheme : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_ATTACHED(GaugeThemeAttached)
+    Q_PROPERTY(QColor faceColor READ faceColor WRITE setFaceColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor bezelColor READ bezelColor WRITE setBezelColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor backgroundArcColor READ backgroundArcColor WRITE setBackgroundArcColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor valueArcColor READ valueArcColor WRITE setValueArcColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor needleColor READ needleColor WRITE setNeedleColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor tickColor READ tickColor WRITE setTickColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor textColor READ textColor WRITE setTextColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor redlineColor READ redlineColor WRITE setRedlineColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor warningColor READ warningColor WRITE setWarningColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor criticalColor READ criticalColor WRITE setCriticalColor NOTIFY paletteChanged)
+    Q_PROPERTY(int transitionDuration READ transitionDuration WRITE setTransitionDuration NOTIFY transitionDurationChanged)
+
+public:
+    enum Role {
+        Face,
+        Bezel,
+        BackgroundArc,
+        ValueArc,
+        Needle,
+        Tick,
+        Text,
+        Redline,
+        Warning,
+        Critical,
+        RoleCount
+    };
+
+    using Palette = std::array<QColor, RoleCount>;
+
+    explicit GaugeTheme(QObject *parent = nullptr);
+
+    const Palette &palette() const { return m_palette; }
+    QColor color(Role role) const { return m_palette[role]; }
+    void setColor(Role role, const QColor &color);
+
+    QColor faceColor() const { return m_palette[Face]; }
+    void setFaceColor(const QColor &color) { setColor(Face, color); }
+    QColor bezelColor() const { return m_palette[Bezel]; }
+    void setBezelColor(const QColor &color) { setColor(Bezel, color); }
+    QColor backgroundArcColor() const { return m_palette[BackgroundArc]; }
+    void setBackgroundArcColor(const QColor &color) { setColor(BackgroundArc, color); }
+    QColor valueArcColor() const { return m_palette[ValueArc]; }
+    void setValueArcColor(const QColor &color) { setColor(ValueArc, color); }
+    QColor needleColor() const { return m_palette[Needle]; }
+    void setNeedleColor(const QColor &color) { setColor(Needle, color); }
+    QColor tickColor() const { return m_palette[Tick]; }
+    void setTickColor(const QColor &color) { setColor(Tick, color); }
+    QColor textColor() const { return m_palette[Text]; }
+    void setTextColor(const QColor &color) { setColor(Text, color); }
+    QColor redlineColor() const { return m_palette[Redline]; }
+    void setRedlineColor(const QColor &color) { setColor(Redline, color); }
+    QColor warningColor() const { return m_palette[Warning]; }
+    void setWarningColor(const QColor &color) { setColor(Warning, color); }
+    QColor criticalColor() const { return m_palette[Critical]; }
+    void setCriticalColor(const QColor &color) { setColor(Critical, color); }
+
+    /**
+     * @brief Duration of color transitions into this theme, in ms (0 = instant).
+     * @default 300
+     */
+    int transitionDuration() const { return m_transitionDuration; }
+    void setTransitionDuration(int duration);
+
+    static GaugeThemeAttached *qmlAttachedProperties(QObject *object);
+
+signals:
+    void paletteChanged();
+    void transitionDurationChanged();
+
+private:
+    Palette m_palette;
+    int m_transitionDuration = 300;
+};
+
+/**
+ * @brief Per-item theme state exposed as the GaugeTheme attached property.
+ *
+ * Provides the effective, transition-animated palette for an item. The
+ * palette comes from the nearest GaugeTheme.theme override on the item or
+ * one of its ancestors, or from GaugeThemes.current.
+ *
+ * All colors share a single paletteChanged() notification, emitted at most
+ * once per flush or clock tick, so a theme switch costs one binding update
+ * per dependent binding instead of one per color.
+ *
+ * @example
+ * @code
+ * RadialGauge {
+ *     GaugeTheme.theme: GaugeTheme { faceColor: "#000000" }  // Override
+ *     faceColor: GaugeTheme.faceColor  // Effective color (what RadialGauge does)
+ * }
+ * @endcode
+ */
+class GaugeThemeAttached : public QObject
+{
+    Q_OBJECT
+    QML_ANONYMOUS
+    Q_PROPERTY(GaugeTheme *theme READ theme WRITE setTheme NOTIFY themeChanged)
+    Q_PROPERTY(QColor faceColor READ faceColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor bezelColor READ bezelColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor backgroundArcColor READ backgroundArcColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor valueArcColor READ valueArcColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor needleColor READ needleColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor tickColor READ tickColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor textColor READ textColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor redlineColor READ redlineColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor warningColor READ warningColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor criticalColor READ criticalColor NOTIFY paletteChanged)
+
+public:
+    explicit GaugeThemeAttached(QObject *parent);
+    ~GaugeThemeAttached() override;
+
+    GaugeTheme *theme() const { return m_theme; }
+    void setTheme(GaugeTheme *theme);
+
+    QColor faceColor() const;
+    QColor bezelColor() const;
+    QColor backgroundArcColor() const;
+    QColor valueArcColor() const;
+    QColor needleColor() const;
+    QColor tickColor() const;
+    QColor textColor() const;
+    QColor redlineColor() const;
+    QColor warningColor() const;
+    QColor criticalColor() const;
+
+signals:
+    void themeChanged();
+    void paletteChanged();
+
+private:
+    friend class GaugeThemes;
+
+    GaugeTheme *resolveTheme() const;
+    bool retarget(int now);
+    bool advance(int now);
+
+    QPointer<GaugeTheme> m_theme;
+
+    // Palette currently displayed, and the transition it is following
+    GaugeTheme::Palette m_current;
+    GaugeTheme::Palette m_from;
+    GaugeTheme::Palette m_to;
+    int m_transitionStart = 0;
+    int m_transitionDuration = 0;
+    bool m_transitioning = false;
+    bool m_initialized = false;
+};
+
+/**
+ * @brief Global theme state and the shared transition clock.
+ *
+ * - current: theme used by every gauge without a GaugeTheme.theme override
+ * - defaultTheme: built-in dark palette (the library's historical defaults)
+ *
+ * Theme changes are flushed as one transaction per event loop pass. All
+ * running color transitions advance from one animation clock, which only
+ * runs while a transition is in progress.
+ */
+class GaugeThemes : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_SINGLETON
+    Q_PROPERTY(GaugeTheme *current READ current WRITE setCurrent NOTIFY currentChanged)
+    Q_PROPERTY(GaugeTheme *defaultTheme READ defaultTheme CONSTANT)
+    Q_PROPERTY(bool transitioning READ isTransitioning NOTIFY transitioningChanged)
+
+public:
+    static GaugeThemes *instance();
+    static GaugeThemes *create(QQmlEngine *qmlEngine, QJSEngine *jsEngine);
+
+    GaugeTheme *current() const;
+    void setCurrent(GaugeTheme *theme);
+
+    GaugeTheme *defaultTheme() const { return m_defaultTheme; }
+    bool isTransitioning() const { return !m_transitioning.isEmpty(); }
+
+    void scheduleFlush();
+
+signals:
+    void currentChanged();
+    void transitioningChanged();
+
+private:
+    friend class GaugeThemeAttached;
+    class Clock;
+
+    explicit GaugeThemes(QObject *parent = nullptr);
+
+    void registerAttached(GaugeThemeAttached *attached);
+    void unregisterAttached(GaugeThemeAttached *attached);
+    void flush();
+    void tick(int now);
+
+    GaugeTheme *m_defaultTheme = nullptr;
+    QPointer<GaugeTheme> m_current;
+    QSet<GaugeThemeAttached *> m_attached;
+    QSet<GaugeThemeAttached *> m_transitioning;
+    Clock *m_clock = nullptr;
+    bool m_flushPending = false;
+};
+
+#endif // GAUGETHEME_H
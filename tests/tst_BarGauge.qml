@@ -0,0 +1,117 @@
+import QtQuick
+import QtTest
+import DevDash.Gauges
+
+/**
+ * @brief Unit tests for BarGauge template
+ *
+ * Verifies segment lighting, zone colors, peak hold, and that value
+ * changes only rewrite the segments whose state changed.
+ */
+TestCase {
+    id: testCase
+    name: "BarGaugeTests"
+    when: windowShown
+
+    width: 600
+    height: 300
+
+    BarGauge {
+        id: bar
+        x: 10
+        y: 10
+        width: 480
+        height: 24
+
+        minValue: 0
+        maxValue: 8000
+        warningThreshold: 6000
+        redlineStart: 7000
+        segmentCount: 80
+        value: 0
+    }
+
+    BarGauge {
+        id: linearBar
+        x: 10
+        y: 60
+        width: 24
+        height: 200
+        vertical: true
+        continuous: true
+        segmentCount: 1
+        segmentSpacing: 0
+    }
+
+    function init() {
+        bar.peakHold = false
+        bar.value = 0
+        waitForRendering(bar)
+    }
+
+    function test_defaults() {
+        compare(linearBar.warningThreshold, linearBar.maxValue, "Warning defaults to maxValue")
+        compare(linearBar.redlineStart, linearBar.maxValue, "Redline defaults to maxValue")
+        compare(bar.normalColor.toString(), "#00aaff", "Theme value arc color")
+        compare(bar.criticalColor.toString(), "#ff4444", "Theme critical color")
+    }
+
+    function test_litSegments() {
+        bar.value = 4000
+        compare(bar.litSegments, 40, "Half the segments lit")
+
+        bar.value = 8000
+        compare(bar.litSegments, 80, "All segments lit")
+
+        bar.value = 9000
+        compare(bar.litSegments, 80, "Value clamped to range")
+
+        linearBar.value = 25
+        compare(linearBar.litSegments, 1, "Continuous bar partially lit")
+    }
+
+    function test_onlyChangedSegmentsUpdated() {
+        bar.value = 2000
+        tryCompare(bar, "lastUpdatedSegments", 20, 1000, "Segments 0-19 turned on")
+
+        bar.value = 2100
+        tryCompare(bar, "lastUpdatedSegments", 1, 1000, "One segment toggled")
+
+        bar.value = 2400
+        tryCompare(bar, "lastUpdatedSegments", 3, 1000, "Three segments toggled")
+    }
+
+    function test_noUpdateWithoutSegmentChange() {
+        bar.value = 3000
+        compare(bar.litSegments, 30)
+
+        // Below half a segment (100 units): LED bar state is unchanged
+        let changes = 0
+        const onChanged = function() { changes++ }
+        bar.litSegmentsChanged.connect(onChanged)
+        bar.value = 3020
+        bar.value = 3040
+        bar.litSegmentsChanged.disconnect(onChanged)
+        compare(changes, 0, "Sub-segment changes do not touch segments")
+    }
+
+    function test_peakHold() {
+        bar.peakHoldTime = 100
+        bar.peakHold = true
+
+        bar.value = 6000
+        bar.value = 3000
+        compare(bar.peakValue, 6000, "Peak held")
+
+        tryCompare(bar, "peakValue", 3000, 1000, "Peak drops after hold time")
+
+        bar.peakHoldTime = 0
+        bar.value = 7000
+        bar.value = 1000
+        wait(150)
+        compare(bar.peakValue, 7000, "Held until reset")
+
+        bar.resetPeak()
+        compare(bar.peakValue, 1000, "Peak reset")
+    }
+}
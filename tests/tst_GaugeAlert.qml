@@ -0,0 +1,162 @@
+import QtQuick
+import QtTest
+import DevDash.Gauges 1.0
+
+/**
+ * @brief Unit tests for GaugeAlert and the shared GaugeAlerts clock
+ *
+ * Verifies threshold levels, hysteresis, dwell time, level-change signals,
+ * that flashing gauges share one phase and that the clock stops once
+ * nothing is alerting.
+ */
+TestCase {
+    id: testCase
+    name: "GaugeAlertTests"
+    when: windowShown
+
+    width: 400
+    height: 400
+
+    GaugeAlert {
+        id: alert
+        warningThreshold: 60
+        criticalThreshold: 80
+    }
+
+    GaugeAlert {
+        id: other
+        warningThreshold: 60
+        criticalThreshold: 80
+    }
+
+    SignalSpy {
+        id: enteredSpy
+        target: alert
+        signalName: "levelEntered"
+    }
+
+    RadialGauge {
+        id: gauge
+        width: 300
+        height: 300
+        warningThreshold: 60
+        redlineStart: 80
+        flashRedline: true
+    }
+
+    function init() {
+        alert.hysteresis = 0
+        alert.dwellTime = 0
+        alert.value = 0
+        alert.flashStyle = GaugeAlert.Blink
+        other.value = 0
+        gauge.value = 0
+        GaugeAlerts.flashPeriod = 500
+        enteredSpy.clear()
+    }
+
+    function test_levels() {
+        compare(alert.level, GaugeAlert.Normal)
+        alert.value = 65
+        compare(alert.level, GaugeAlert.Warning)
+        verify(alert.alerting)
+        alert.value = 85
+        compare(alert.level, GaugeAlert.Critical)
+        alert.value = 10
+        compare(alert.level, GaugeAlert.Normal)
+    }
+
+    function test_levelEnteredSignal() {
+        alert.value = 85
+        compare(enteredSpy.count, 1, "One signal per change, not per threshold crossed")
+        compare(enteredSpy.signalArguments[0][0], GaugeAlert.Critical)
+        compare(enteredSpy.signalArguments[0][1], GaugeAlert.Normal)
+
+        alert.value = 86
+        alert.value = 90
+        compare(enteredSpy.count, 1, "No signal while the level holds")
+    }
+
+    function test_hysteresis() {
+        alert.hysteresis = 5
+        alert.value = 61
+        compare(alert.level, GaugeAlert.Warning)
+        alert.value = 57
+        compare(alert.level, GaugeAlert.Warning, "Held within the hysteresis band")
+        alert.value = 59.5
+        alert.value = 56
+        compare(alert.level, GaugeAlert.Warning)
+        alert.value = 54
+        compare(alert.level, GaugeAlert.Normal, "Cleared below threshold - hysteresis")
+    }
+
+    function test_dwellTime() {
+        alert.dwellTime = 150
+        alert.value = 70
+        compare(alert.level, GaugeAlert.Normal, "Not adopted before the dwell time")
+
+        // A short spike never reaches the dwell time
+        alert.value = 10
+        wait(200)
+        compare(alert.level, GaugeAlert.Normal, "Spike filtered")
+
+        alert.value = 70
+        tryCompare(alert, "level", GaugeAlert.Warning, 1000, "Adopted after the dwell time")
+        compare(enteredSpy.count, 1)
+    }
+
+    function test_flashingSharesPhase() {
+        alert.value = 90
+        other.value = 90
+        verify(alert.flashing && other.flashing)
+        verify(GaugeAlerts.running, "Clock runs while flashing")
+
+        let toggles = 0
+        let last = alert.flashOn
+        for (let i = 0; i < 40; i++) {
+            wait(25)
+            compare(alert.flashOn, other.flashOn, "Alerts in phase")
+            compare(alert.flashOn, GaugeAlerts.flashOn)
+            if (alert.flashOn !== last) {
+                toggles++
+                last = alert.flashOn
+            }
+        }
+        verify(toggles >= 2, "Blinks (" + toggles + " toggles in 1 s)")
+    }
+
+    function test_pulse() {
+        alert.flashStyle = GaugeAlert.Pulse
+        alert.value = 90
+        let low = 1
+        let high = 0
+        for (let i = 0; i < 25; i++) {
+            wait(40)
+            low = Math.min(low, alert.pulse)
+            high = Math.max(high, alert.pulse)
+        }
+        verify(high - low > 0.5, "Pulse sweeps (" + low + " - " + high + ")")
+    }
+
+    function test_clockStopsWhenIdle() {
+        alert.value = 90
+        verify(GaugeAlerts.running)
+        alert.value = 0
+        other.value = 0
+        gauge.value = 0
+        verify(!GaugeAlerts.running, "Clock stopped with no flashing alert")
+        verify(alert.flashOn, "Steady when not flashing")
+        compare(alert.pulse, 1)
+    }
+
+    function test_radialGaugeAlert() {
+        gauge.value = 70
+        compare(gauge.alertLevel, GaugeAlert.Warning)
+        verify(!GaugeAlerts.running, "Warnings do not flash the redline")
+        gauge.value = 90
+        compare(gauge.alertLevel, GaugeAlert.Critical)
+        verify(GaugeAlerts.running, "Redline flashes while critical")
+        gauge.value = 10
+        compare(gauge.alertLevel, GaugeAlert.Normal)
+    }
+}
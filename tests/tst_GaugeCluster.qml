@@ -0,0 +1,199 @@
+import QtQuick
+import QtTest
+import DevDash.Gauges
+
+/**
+ * @brief Unit tests for GaugeCluster
+ *
+ * Verifies that culled and occluded gauges receive no value writes, that
+ * low-priority gauges are throttled and staggered across frames, and that
+ * effective update rates are reported.
+ */
+TestCase {
+    id: testCase
+    name: "GaugeClusterTests"
+    when: windowShown
+
+    width: 800
+    height: 600
+
+    // Minimal gauge that records when its value is written
+    component ProbeGauge: Item {
+        width: 40
+        height: 40
+        property real value: 0
+        property int writes: 0
+        property var writeTimes: []
+        onValueChanged: {
+            writes++
+            writeTimes.push(Date.now())
+        }
+    }
+
+    GaugeCluster {
+        id: cluster
+        width: 800
+        height: 600
+        lowUpdateRate: 10
+        occluders: [overlay]
+
+        property real feed: 0
+
+        ProbeGauge {
+            id: fastGauge
+            GaugeCluster.source: cluster.feed
+            GaugeCluster.priority: GaugeCluster.High
+        }
+
+        ProbeGauge {
+            id: hiddenGauge
+            x: 50
+            GaugeCluster.source: cluster.feed
+        }
+
+        ProbeGauge {
+            id: coveredGauge
+            x: 100
+            GaugeCluster.source: cluster.feed
+        }
+
+        Item {
+            id: viewport
+            x: 200
+            width: 100
+            height: 100
+            clip: true
+
+            ProbeGauge {
+                id: scrolledGauge
+                x: 150  // Outside the clipped viewport
+                GaugeCluster.source: cluster.feed
+            }
+        }
+
+        Row {
+            id: slowRow
+            y: 300
+
+            Repeater {
+                id: slowGauges
+                model: 12
+                ProbeGauge {
+                    GaugeCluster.source: cluster.feed
+                    GaugeCluster.priority: GaugeCluster.Low
+                }
+            }
+        }
+
+        Rectangle {
+            id: overlay
+            x: 90
+            y: -10
+            width: 60
+            height: 60
+            color: "black"
+            visible: false
+        }
+    }
+
+    function init() {
+        overlay.visible = false
+        hiddenGauge.visible = true
+        cluster.updateCulling()
+        cluster.feed = 0
+        wait(150)
+    }
+
+    function test_registration() {
+        compare(cluster.gaugeCount, 16, "All gauges inside the cluster registered")
+        compare(fastGauge.GaugeCluster.targetUpdateRate, 0, "High priority is unthrottled")
+        compare(slowGauges.itemAt(0).GaugeCluster.targetUpdateRate, 10, "Low priority rate")
+    }
+
+    function test_unthrottledWritesImmediately() {
+        cluster.feed = 42
+        compare(fastGauge.value, 42, "Written synchronously")
+    }
+
+    function test_hiddenGaugeSkipped() {
+        hiddenGauge.visible = false
+        cluster.updateCulling()
+        verify(hiddenGauge.GaugeCluster.culled, "Invisible gauge culled")
+
+        const writes = hiddenGauge.writes
+        cluster.feed = 10
+        cluster.feed = 20
+        compare(hiddenGauge.writes, writes, "No writes while culled")
+
+        hiddenGauge.visible = true
+        cluster.updateCulling()
+        compare(hiddenGauge.value, 20, "Latest value written when visible again")
+        compare(hiddenGauge.writes, writes + 1, "One catch-up write")
+    }
+
+    function test_occludedGaugeSkipped() {
+        overlay.visible = true
+        cluster.updateCulling()
+        verify(coveredGauge.GaugeCluster.culled, "Fully covered gauge culled")
+        verify(!fastGauge.GaugeCluster.culled, "Uncovered gauge not culled")
+
+        cluster.feed = 30
+        compare(coveredGauge.value, 0, "Occluded gauge not updated")
+        compare(fastGauge.value, 30)
+    }
+
+    function test_clippedGaugeSkipped() {
+        verify(scrolledGauge.GaugeCluster.culled, "Gauge outside clip viewport culled")
+
+        scrolledGauge.x = 20
+        cluster.updateCulling()
+        verify(!scrolledGauge.GaugeCluster.culled, "Scrolled into view")
+        scrolledGauge.x = 150
+        cluster.updateCulling()
+    }
+
+    function test_lowPriorityThrottled() {
+        const gauge = slowGauges.itemAt(0)
+        const writes = gauge.writes
+
+        // 50 changes over ~500 ms at a 10 Hz limit
+        for (let i = 1; i <= 50; i++) {
+            cluster.feed = i
+            wait(10)
+        }
+        tryCompare(gauge, "value", 50, 500, "Last value eventually written")
+        verify(gauge.writes - writes <= 8,
+               "Throttled to ~10 Hz (" + (gauge.writes - writes) + " writes)")
+    }
+
+    function test_updatesStaggered() {
+        for (let i = 0; i < slowGauges.count; i++)
+            slowGauges.itemAt(i).writeTimes = []
+
+        cluster.feed = 100
+        for (let i = 0; i < slowGauges.count; i++)
+            tryCompare(slowGauges.itemAt(i), "value", 100, 500)
+
+        // The same change lands on different ticks across the 100 ms period
+        const times = []
+        for (let i = 0; i < slowGauges.count; i++)
+            times.push(slowGauges.itemAt(i).writeTimes[0])
+        const spread = Math.max.apply(null, times) - Math.min.apply(null, times)
+        verify(spread >= 40, "Writes spread across the period (" + spread + " ms)")
+    }
+
+    function test_effectiveRateReported() {
+        const gauge = slowGauges.itemAt(3)
+        for (let i = 1; i <= 120; i++) {
+            cluster.feed = i
+            wait(20)
+        }
+
+        const rate = gauge.GaugeCluster.effectiveUpdateRate
+        verify(rate > 5 && rate <= 11, "Effective rate near 10 Hz (" + rate + ")")
+
+        const report = cluster.updateRates()
+        compare(report.length, cluster.gaugeCount, "One entry per gauge")
+        verify(report[0].hasOwnProperty("effectiveRate"))
+    }
+}
@@ -0,0 +1,159 @@
+import QtQuick
+import QtTest
+import DevDash.Gauges 1.0
+import DevDash.Gauges.Compounds 1.0
+
+/**
+ * @brief Unit tests for the compiled GaugePresets engine
+ *
+ * Verifies that presets compiled from presets/ are available at runtime,
+ * apply as one batch (bindings only see the complete preset), and measures
+ * live preset switching on a 12-needle cluster.
+ */
+TestCase {
+    id: testCase
+    name: "GaugePresetsTests"
+    when: windowShown
+
+    width: 800
+    height: 600
+
+    GaugeNeedle {
+        id: needle
+        width: 300
+        height: 300
+        animated: false
+
+        // Records every value a binding over two preset properties takes
+        property var observedKeys: []
+        readonly property real geometryKey: frontLength * 1000 + pivotWidth
+        onGeometryKeyChanged: observedKeys.push(geometryKey)
+
+        property int frontLengthChanges: 0
+        onFrontLengthChanged: frontLengthChanges++
+    }
+
+    // Depends on preset properties from outside the target
+    QtObject {
+        id: observer
+        readonly property real reach: needle.frontLength + needle.pivotWidth
+        readonly property real needleLength: needle.totalLength
+    }
+
+    SignalSpy {
+        id: appliedSpy
+        target: GaugePresets
+        signalName: "applied"
+    }
+
+    // Live cluster for the switching benchmark
+    Grid {
+        id: cluster
+        columns: 4
+        y: 300
+
+        Repeater {
+            model: 12
+            GaugeNeedle {
+                width: 120
+                height: 100
+                angle: index * 20
+                frontLength: 40
+                animated: false
+            }
+        }
+    }
+
+    function init() {
+        GaugePresets.apply(needle, "stock")
+    }
+
+    function test_compiledPresetsAvailable() {
+        verify(GaugePresets.components.indexOf("GaugeNeedle") >= 0, "GaugeNeedle presets compiled")
+        verify(GaugePresets.presets("GaugeNeedle").indexOf("autometer") >= 0, "autometer preset")
+        compare(GaugePresets.preset("GaugeNeedle", "autometer").name, "AutoMeter", "Preset metadata")
+    }
+
+    function test_applySetsAllProperties() {
+        verify(GaugePresets.apply(needle, "autometer"), "Preset applied")
+        compare(needle.frontColor.toString(), "#ff2200", "Color converted")
+        compare(needle.frontLength, 110, "Real value")
+        compare(needle.frontGradient, true, "Bool value")
+        compare(needle.headTipShape, "none", "String value")
+        compare(needle.tailTipShape, "flat", "String value")
+    }
+
+    function test_componentInferredFromTarget() {
+        verify(GaugePresets.apply(needle, "autometer"), "Component derived from type")
+        compare(needle.frontGradientStyle, "ridge")
+    }
+
+    function test_bindingsSeeCompletePreset() {
+        needle.observedKeys = []
+        GaugePresets.apply(needle, "autometer")
+
+        // frontLength (100 -> 110) and pivotWidth (10 -> 5) both change.
+        // Notifications are held back until both are written, so the
+        // half-applied state 110010 is never observed.
+        compare(needle.observedKeys, [110005], "Binding only sees the complete preset")
+    }
+
+    function test_dependentBindingsNotified() {
+        const stockLength = needle.totalLength
+        needle.frontLengthChanges = 0
+        GaugePresets.apply(needle, "autometer")
+
+        // The blocked notify signals are re-emitted after the batch
+        compare(observer.reach, 115, "Outside binding sees frontLength and pivotWidth")
+        compare(needle.frontLengthChanges, 1, "Change handler ran once")
+        verify(needle.totalLength !== stockLength, "Binding inside the target re-evaluated")
+        compare(observer.needleLength, needle.totalLength, "Derived property notified onwards")
+    }
+
+    function test_unchangedValuesSkipped() {
+        GaugePresets.apply(needle, "autometer")
+        appliedSpy.clear()
+
+        GaugePresets.apply(needle, "autometer")
+        compare(appliedSpy.count, 1)
+        compare(appliedSpy.signalArguments[0][2], 0, "Re-applying changes nothing")
+    }
+
+    function test_unknownPreset() {
+        ignoreWarning(/GaugePresets: no preset .*missing.*/)
+        verify(!GaugePresets.apply(needle, "missing"), "Unknown preset rejected")
+    }
+
+    // Alternates every needle between two presets on each iteration.
+    // benchmark_switchPresetPerProperty is the pre-compiled path for
+    // comparison: each property assigned from the preset map in turn.
+    property int benchmarkPass: 0
+    readonly property var presetValues: ({
+        "autometer": GaugePresets.preset("GaugeNeedle", "autometer").properties,
+        "stock": GaugePresets.preset("GaugeNeedle", "stock").properties
+    })
+
+    function benchmark_switchPresetLive() {
+        const presets = ["autometer", "stock"]
+        for (let i = 0; i < cluster.children.length; i++) {
+            const gauge = cluster.children[i]
+            if (gauge.frontLength !== undefined) {
+                GaugePresets.apply(gauge, presets[(i + benchmarkPass) % 2])
+            }
+        }
+        benchmarkPass++
+    }
+
+    function benchmark_switchPresetPerProperty() {
+        const presets = ["autometer", "stock"]
+        for (let i = 0; i < cluster.children.length; i++) {
+            const gauge = cluster.children[i]
+            if (gauge.frontLength !== undefined) {
+                const values = presetValues[presets[(i + benchmarkPass) % 2]]
+                for (const name in values)
+                    gauge[name] = values[name]
+            }
+        }
+        benchmarkPass++
+    }
+}
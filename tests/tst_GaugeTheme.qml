@@ -0,0 +1,224 @@
+import QtQuick
+import QtTest
+import DevDash.Gauges 1.0
+
+/**
+ * @brief Unit tests for GaugeTheme / GaugeThemes
+ *
+ * Verifies theme resolution (global, attached overrides), that theme
+ * changes are coalesced into one update per gauge, that transitions
+ * on a 12-gauge cluster run in lockstep from the shared clock, and that
+ * no ColorAnimation chases the clock while they run.
+ */
+TestCase {
+    id: testCase
+    name: "GaugeThemeTests"
+    when: windowShown
+
+    width: 800
+    height: 600
+
+    GaugeTheme {
+        id: dayTheme
+        transitionDuration: 0
+    }
+
+    GaugeTheme {
+        id: nightTheme
+        faceColor: "#000000"
+        needleColor: "#ff3300"
+        tickColor: "#aa4400"
+        textColor: "#ff6600"
+        transitionDuration: 0
+    }
+
+    GaugeTheme {
+        id: fadingTheme
+        faceColor: "#102030"
+        needleColor: "#00ff00"
+        valueArcColor: "#ff00ff"
+        textColor: "#00ffff"
+        transitionDuration: 200
+    }
+
+    // 12-gauge cluster, each counting how often its colors change
+    Grid {
+        id: cluster
+        columns: 4
+
+        Repeater {
+            id: gauges
+            model: 12
+            RadialGauge {
+                width: 150
+                height: 150
+                value: index * 8
+                showDigitalReadout: true
+
+                property int faceChanges: 0
+                property int needleChanges: 0
+                onFaceColorChanged: faceChanges++
+                onNeedleColorChanged: needleChanges++
+            }
+        }
+    }
+
+    Item {
+        id: overrideScope
+        y: 450
+        width: 300
+        height: 150
+
+        RadialGauge {
+            id: scopedGauge
+            width: 150
+            height: 150
+        }
+    }
+
+    FrameAnimation {
+        id: frames
+        running: true
+        property int count: 0
+        onTriggered: count++
+    }
+
+    function resetCounters() {
+        for (let i = 0; i < gauges.count; i++) {
+            gauges.itemAt(i).faceChanges = 0
+            gauges.itemAt(i).needleChanges = 0
+        }
+    }
+
+    function findChild(item, property) {
+        for (let i = 0; i < item.children.length; i++) {
+            if (item.children[i][property] !== undefined)
+                return item.children[i]
+        }
+        return null
+    }
+
+    function init() {
+        GaugeThemes.current = dayTheme
+        overrideScope.GaugeTheme.theme = null
+        wait(0)
+        resetCounters()
+    }
+
+    function cleanupTestCase() {
+        // The singleton outlives this test file
+        GaugeThemes.current = null
+    }
+
+    function test_defaultPalette() {
+        compare(GaugeThemes.defaultTheme.faceColor.toString(), "#1a1a1a")
+        compare(gauges.itemAt(0).faceColor.toString(), "#1a1a1a", "Gauge uses theme color")
+        compare(gauges.itemAt(0).valueArcColor.toString(), "#00aaff")
+    }
+
+    function test_nightSwitchInOneUpdate() {
+        GaugeThemes.current = nightTheme
+        wait(0)
+
+        for (let i = 0; i < gauges.count; i++) {
+            const gauge = gauges.itemAt(i)
+            compare(gauge.faceColor.toString(), "#000000", "Gauge " + i + " switched")
+            compare(gauge.needleColor.toString(), "#ff3300")
+            compare(gauge.faceChanges, 1, "One face update for gauge " + i)
+            compare(gauge.needleChanges, 1, "One needle update for gauge " + i)
+        }
+        verify(!GaugeThemes.transitioning, "Instant themes never start the clock")
+    }
+
+    function test_changesCoalesced() {
+        GaugeThemes.current = nightTheme
+        nightTheme.faceColor = "#050505"
+        nightTheme.faceColor = "#000000"
+        GaugeThemes.current = dayTheme
+        GaugeThemes.current = nightTheme
+        wait(0)
+
+        compare(gauges.itemAt(0).faceColor.toString(), "#000000")
+        compare(gauges.itemAt(0).faceChanges, 1, "Five changes, one update")
+    }
+
+    function test_transitionSharedClock() {
+        GaugeThemes.current = fadingTheme
+        wait(0)
+        verify(GaugeThemes.transitioning, "Transition running")
+
+        const firstFrame = frames.count
+        wait(80)
+
+        // Every gauge follows the same clock, so mid-transition colors match
+        const midColor = gauges.itemAt(0).faceColor.toString()
+        verify(midColor !== "#1a1a1a" && midColor !== "#102030", "Mid-transition color")
+        for (let i = 1; i < gauges.count; i++)
+            compare(gauges.itemAt(i).faceColor.toString(), midColor, "Gauge " + i + " in phase")
+
+        tryCompare(GaugeThemes, "transitioning", false, 1000)
+        compare(gauges.itemAt(11).faceColor.toString(), "#102030", "Transition completed")
+
+        // At most one palette update per frame, plus the final snap
+        const elapsedFrames = frames.count - firstFrame
+        verify(gauges.itemAt(0).faceChanges <= elapsedFrames + 1,
+               "Updates bounded by frames (" + gauges.itemAt(0).faceChanges
+               + " updates, " + elapsedFrames + " frames)")
+    }
+
+    function test_transitionSkipsColorAnimations() {
+        const gauge = gauges.itemAt(0)
+        const valueArc = findChild(gauge, "valueSweepAngle")
+        const arc = findChild(valueArc, "useGradient")
+        const readout = findChild(gauge, "integerDigits")
+        verify(arc && readout, "Value arc and readout found")
+        // The readout's value item, loaded into the first row of its Column
+        const readoutValue = readout.children[0].children[0].item
+
+        GaugeThemes.current = fadingTheme
+        wait(0)
+        verify(GaugeThemes.transitioning, "Transition running")
+        verify(!valueArc.colorAnimated, "Value arc Behaviors off")
+        verify(!readout.colorAnimated, "Readout Behaviors off")
+
+        // A running ColorAnimation would hold the drawn colors behind the
+        // clock; without one they match the gauge on every step
+        for (let step = 0; step < 5 && GaugeThemes.transitioning; step++) {
+            wait(30)
+            compare(arc.strokeColor.toString(), gauge.valueArcColor.toString(),
+                    "Arc color on the clock at step " + step)
+            compare(readoutValue.color.toString(), gauge.textColor.toString(),
+                    "Readout color on the clock at step " + step)
+        }
+
+        tryCompare(GaugeThemes, "transitioning", false, 1000)
+        compare(arc.strokeColor.toString(), "#ff00ff", "Arc reached the theme color")
+        compare(readoutValue.color.toString(), "#00ffff", "Readout reached the theme color")
+        verify(valueArc.colorAnimated, "Alert color animations restored")
+        verify(readout.colorAnimated)
+    }
+
+    function test_attachedOverride() {
+        overrideScope.GaugeTheme.theme = nightTheme
+        wait(0)
+
+        compare(scopedGauge.faceColor.toString(), "#000000", "Descendant uses override")
+        compare(gauges.itemAt(0).faceColor.toString(), "#1a1a1a", "Others keep global theme")
+
+        overrideScope.GaugeTheme.theme = null
+        wait(0)
+        compare(scopedGauge.faceColor.toString(), "#1a1a1a", "Override removed")
+    }
+
+    function test_explicitColorWins() {
+        const gauge = gauges.itemAt(3)
+        gauge.faceColor = "#123456"
+        GaugeThemes.current = nightTheme
+        wait(0)
+
+        compare(gauge.faceColor.toString(), "#123456", "Assigned color pinned")
+        compare(gauge.needleColor.toString(), "#ff3300", "Other colors still themed")
+
+        gauge.faceColor = Qt.binding(function() { return gauge.GaugeTheme.faceColor })
+    }
+}
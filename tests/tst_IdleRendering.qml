@@ -0,0 +1,185 @@
+import QtQuick
+import QtTest
+import DevDash.Gauges 1.0
+import DevDash.Gauges.Primitives 1.0
+
+/**
+ * @brief Unit tests for idle-aware rendering
+ *
+ * Verifies that a gauge fed constant input, or input jittering below the
+ * needle's settleThreshold and the arc's settleStep, next to a visible
+ * PerformanceOverlay, renders no frames at all, that moving parts report
+ * themselves to FrameActivity by gauge name, and that FrameStats counts
+ * frames without requesting any.
+ */
+TestCase {
+    id: testCase
+    name: "IdleRenderingTests"
+    when: windowShown
+
+    width: 500
+    height: 400
+
+    RadialGauge {
+        id: gauge
+        objectName: "coolant"
+        width: 300
+        height: 300
+        minValue: 0
+        maxValue: 120
+        value: 0
+    }
+
+    PerformanceOverlay {
+        id: overlay
+        x: 320
+        y: 10
+    }
+
+    FrameStats {
+        id: stats
+        window: gauge.Window.window
+    }
+
+    SignalSpy {
+        id: requestSpy
+        target: FrameActivity
+        signalName: "frameRequested"
+    }
+
+    // Sensor feed at 50 Hz, alternating feedValue ± feedJitter
+    property real feedValue: 0
+    property real feedJitter: 0
+    property bool feedHigh: false
+
+    Timer {
+        id: feed
+        interval: 20
+        repeat: true
+        onTriggered: {
+            testCase.feedHigh = !testCase.feedHigh
+            gauge.value = testCase.feedValue + (testCase.feedHigh ? testCase.feedJitter : -testCase.feedJitter)
+        }
+    }
+
+    function findChild(item, property) {
+        for (let i = 0; i < item.children.length; i++) {
+            if (item.children[i][property] !== undefined)
+                return item.children[i]
+        }
+        return null
+    }
+
+    function settle() {
+        tryCompare(FrameActivity, "activeCount", 0, 5000, "Moving parts settle")
+        tryCompare(stats, "active", false, 2000, "Window stops rendering")
+        // Let the overlay flip to idle; that single frame is not a burst
+        wait(300)
+    }
+
+    function init() {
+        feed.stop()
+        testCase.feedJitter = 0
+        FrameActivity.tracing = false
+        requestSpy.clear()
+    }
+
+    function test_zeroFramesWithConstantInput() {
+        testCase.feedValue = 40
+        gauge.value = 40
+        settle()
+        verify(gauge.settled)
+
+        const before = stats.frameCount
+        feed.start()
+        wait(2000)
+        feed.stop()
+
+        compare(stats.frameCount, before, "No frames over 2 s of constant input")
+        verify(FrameActivity.idle)
+        verify(overlay.idle, "Overlay reports idle instead of rendering")
+    }
+
+    function test_zeroFramesWithSubPixelJitter() {
+        const needle = findChild(gauge, "settleThreshold")
+        const valueArc = findChild(gauge, "settleStep")
+        verify(needle, "RadialGauge has a GaugeNeedle")
+        verify(valueArc, "RadialGauge has a GaugeValueArc")
+        verify(valueArc.settleStep > 0)
+
+        // Both tolerances in value units
+        const range = gauge.maxValue - gauge.minValue
+        const needleTolerance = needle.settleThreshold * range / gauge.sweepAngle
+        const arcStep = valueArc.settleStep * range / valueArc.totalSweepAngle
+
+        // Rest on an arc step so the jitter cannot round to its neighbour,
+        // and stay well inside half a step and the needle threshold
+        const base = gauge.minValue + Math.round((40 - gauge.minValue) / arcStep) * arcStep
+        testCase.feedValue = base
+        testCase.feedJitter = Math.min(arcStep / 2, needleTolerance) / 4
+        verify(testCase.feedJitter > 0)
+
+        gauge.value = base
+        settle()
+        verify(gauge.settled)
+
+        const before = stats.frameCount
+        const sweep = valueArc.valueSweepAngle
+        feed.start()
+        wait(2000)
+        feed.stop()
+
+        verify(gauge.value !== base, "Feed delivered jittered values")
+        compare(valueArc.valueSweepAngle, sweep, "Arc sweep stays on its step")
+        verify(gauge.settled, "Needle never restarted")
+        compare(stats.frameCount, before, "No frames over 2 s of sub-pixel jitter")
+        verify(FrameActivity.idle)
+    }
+
+    function test_framesAttributedToGauge() {
+        gauge.value = 40
+        settle()
+
+        gauge.value = 100
+        verify(!gauge.settled, "Needle moving")
+        verify(requestSpy.count > 0, "Frame request reported")
+        compare(FrameActivity.describe(requestSpy.signalArguments[0][0]), "coolant")
+        verify(FrameActivity.activeReasons.indexOf("coolant: needle settling") >= 0,
+               "Active reasons: " + FrameActivity.activeReasons)
+
+        tryVerify(function() { return stats.lastFrameReasons.length > 0 }, 1000,
+                  "Rendered frames carry their reasons")
+        settle()
+        verify(gauge.settled)
+    }
+
+    function test_tracingReportsValueChanges() {
+        gauge.value = 40
+        settle()
+
+        FrameActivity.tracing = true
+        requestSpy.clear()
+        gauge.value = 41
+
+        let reported = false
+        for (let i = 0; i < requestSpy.count; i++) {
+            if (requestSpy.signalArguments[i][1] === "value")
+                reported = true
+        }
+        verify(reported, "Value change reported while tracing")
+        settle()
+    }
+
+    function test_statsMeasureBursts() {
+        gauge.value = 0
+        settle()
+        stats.reset()
+
+        gauge.value = 120
+        tryCompare(stats, "active", true, 1000, "Needle sweep is a burst")
+        tryVerify(function() { return stats.fps > 0 }, 1000)
+        verify(stats.frameTimes().length > 0)
+        settle()
+        verify(stats.frameCount > 1)
+    }
+}
@@ -0,0 +1,150 @@
+import QtQuick
+import QtTest
+import DevDash.Gauges 1.0
+import DevDash.Gauges.Compounds 1.0
+
+/**
+ * @brief Unit tests for MultiZoneArc
+ *
+ * Verifies band parsing, that the strip is re-tessellated for band and
+ * geometry changes but not for opacity or position, and that RadialGauge
+ * draws its zones with one MultiZoneArc.
+ */
+TestCase {
+    id: testCase
+    name: "MultiZoneArcTests"
+    when: windowShown
+
+    width: 700
+    height: 400
+
+    readonly property var coolantBands: [
+        { from: 40,  to: 60,  color: "#2266ff" },
+        { from: 60,  to: 75,  color: "#2266ff", endColor: "#22cc66" },
+        { from: 75,  to: 105, color: "#22cc66" },
+        { from: 105, to: 115, color: "#22cc66", endColor: "#ffaa00" },
+        { from: 115, to: 130, color: "#ff4444" }
+    ]
+
+    MultiZoneArc {
+        id: arc
+        width: 300
+        height: 300
+        minValue: 40
+        maxValue: 130
+    }
+
+    MultiZoneArc {
+        id: defaultArc
+        y: 320
+        width: 60
+        height: 60
+    }
+
+    RadialGauge {
+        id: gauge
+        x: 350
+        width: 300
+        height: 300
+        minValue: 40
+        maxValue: 130
+    }
+
+    function findZones(item) {
+        for (let i = 0; i < item.children.length; i++) {
+            if (item.children[i].bandCount !== undefined)
+                return item.children[i]
+        }
+        return null
+    }
+
+    // Give a pending sync the chance to run, then read the count
+    function settledCount() {
+        waitForRendering(arc)
+        wait(50)
+        return arc.tessellationCount
+    }
+
+    function init() {
+        arc.bands = coolantBands
+        arc.width = 300
+        arc.height = 300
+        arc.x = 0
+        arc.opacity = 1
+        arc.strokeWidth = 20
+        settledCount()
+    }
+
+    function test_defaults() {
+        compare(defaultArc.bandCount, 0)
+        compare(defaultArc.minValue, 0)
+        compare(defaultArc.maxValue, 100)
+        compare(defaultArc.gaugeStartAngle, -225)
+        compare(defaultArc.gaugeTotalSweep, 270)
+        compare(defaultArc.strokeWidth, 20)
+        compare(defaultArc.tessellationCount, 0, "Nothing to tessellate without bands")
+    }
+
+    function test_bandParsing() {
+        compare(arc.bandCount, 5)
+
+        arc.bands = [
+            { from: 40, to: 60, color: "#2266ff" },
+            { from: 90, to: 70, color: "#22cc66" },   // reversed: swapped
+            { from: 60, color: "#ffaa00" },           // no end: skipped
+            { from: 60, to: 70, color: "not a color" } // skipped
+        ]
+        compare(arc.bandCount, 2)
+    }
+
+    function test_radiusFitsItem() {
+        compare(arc.radius, 140)
+        arc.strokeWidth = 30
+        compare(arc.radius, 135)
+        arc.radius = 100
+        arc.width = 400
+        compare(arc.radius, 100, "Explicit radius kept on resize")
+        arc.radius = undefined
+        compare(arc.radius, 135)
+    }
+
+    function test_retessellatesOnBandsAndGeometry() {
+        let count = settledCount()
+
+        arc.bands = coolantBands.slice(1)
+        tryCompare(arc, "tessellationCount", count + 1, 1000, "New bands")
+        count = settledCount()
+
+        arc.width = 320
+        tryCompare(arc, "tessellationCount", count + 1, 1000, "Resize")
+        count = settledCount()
+
+        arc.maxValue = 140
+        tryCompare(arc, "tessellationCount", count + 1, 1000, "Range change")
+        arc.maxValue = 130
+    }
+
+    function test_noTessellationForNodeState() {
+        const count = settledCount()
+
+        arc.opacity = 0.5
+        arc.x = 20
+        arc.bands = coolantBands  // same list
+        compare(settledCount(), count, "Opacity, position and equal bands reuse the strip")
+    }
+
+    function test_radialGaugeZones() {
+        const zones = findZones(gauge)
+        verify(zones, "RadialGauge has a MultiZoneArc layer")
+        verify(!zones.visible, "Hidden without zones")
+
+        gauge.zones = coolantBands
+        compare(zones.bandCount, 5)
+        verify(zones.visible)
+        compare(zones.minValue, 40)
+        compare(zones.maxValue, 130)
+
+        gauge.zones = []
+        verify(!zones.visible)
+    }
+}
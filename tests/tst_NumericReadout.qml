@@ -0,0 +1,153 @@
+import QtQuick
+import QtTest
+import DevDash.Gauges.Compounds 1.0
+
+/**
+ * @brief Unit tests for NumericReadout
+ *
+ * Verifies that value changes rewrite only the glyphs that changed, that an
+ * unchanged formatted value schedules no frame, that color changes tint
+ * the atlas instead of re-baking it, that tabular layout keeps a stable
+ * width, and benchmarks high-rate updates against a Text readout.
+ */
+TestCase {
+    id: testCase
+    name: "NumericReadoutTests"
+    when: windowShown
+
+    width: 400
+    height: 300
+
+    NumericReadout {
+        id: readout
+        x: 10
+        y: 10
+        width: 300
+        height: 60
+        integerDigits: 4
+        unit: "RPM"
+        font.pixelSize: 40
+    }
+
+    NumericReadout {
+        id: benchReadout
+        x: 10
+        y: 100
+        width: 300
+        height: 60
+        integerDigits: 4
+        precision: 1
+        font.pixelSize: 40
+    }
+
+    Text {
+        id: benchText
+        x: 10
+        y: 180
+        width: 300
+        height: 60
+        horizontalAlignment: Text.AlignHCenter
+        font.pixelSize: 40
+        property real value: 0
+        text: value.toFixed(1)
+    }
+
+    SignalSpy {
+        id: frameSpy
+        target: readout.Window.window
+        signalName: "frameSwapped"
+    }
+
+    property int benchmarkPass: 0
+
+    function init() {
+        readout.precision = 0
+        readout.tabular = true
+        readout.value = 0
+        waitForRendering(readout)
+    }
+
+    function test_defaults() {
+        compare(benchReadout.tabular, true)
+        compare(benchReadout.unitScale, 0.5)
+        compare(benchReadout.horizontalAlignment, Qt.AlignHCenter)
+        verify(readout.implicitWidth > 0 && readout.implicitHeight > 0, "Sized from the atlas")
+    }
+
+    function test_onlyChangedGlyphsUpdated() {
+        readout.value = 1234
+        waitForRendering(readout)
+
+        readout.value = 1235
+        tryCompare(readout, "lastUpdatedGlyphs", 1, 1000, "Only the last digit rewritten")
+
+        readout.value = 1246
+        tryCompare(readout, "lastUpdatedGlyphs", 2, 1000, "Two digits rewritten")
+    }
+
+    function test_noFrameWhenTextUnchanged() {
+        readout.value = 3000
+        waitForRendering(readout)
+        wait(50)
+
+        // Rounds to the same text: no quads change and no frame is requested
+        frameSpy.clear()
+        readout.value = 3000.2
+        readout.value = 2999.8
+        wait(100)
+        compare(frameSpy.count, 0, "No frame for an unchanged readout")
+    }
+
+    function test_colorChangeKeepsAtlas() {
+        readout.value = 1234
+        waitForRendering(readout)
+        const bakes = readout.atlasBakeCount
+        verify(bakes > 0, "Atlas baked")
+
+        // Steps of a color animation: tinted, not re-baked or re-laid out
+        const colors = ["#ff0000", "#ff4400", "#ff8800", "#ffcc00", "white"]
+        for (let i = 0; i < colors.length; i++) {
+            readout.color = colors[i]
+            waitForRendering(readout)
+        }
+        compare(readout.atlasBakeCount, bakes, "Color changes do not re-bake the atlas")
+        compare(readout.lastUpdatedGlyphs, 0, "Color changes rewrite no quads")
+    }
+
+    function test_tabularWidth() {
+        readout.value = 1111
+        const width = readout.implicitWidth
+        readout.value = 8888
+        compare(readout.implicitWidth, width, "Width independent of the digits")
+        readout.value = 7
+        compare(readout.implicitWidth, width, "Room kept for integerDigits")
+
+        readout.precision = 2
+        verify(readout.implicitWidth > width, "Decimals widen the field")
+    }
+
+    function test_nonFiniteValue() {
+        readout.value = 42
+        waitForRendering(readout)
+        readout.value = NaN
+        waitForRendering(readout)
+        verify(readout.lastUpdatedGlyphs > 0, "Dashes drawn in place of the digits")
+        readout.value = 42
+        waitForRendering(readout)
+    }
+
+    // Same update stream through the atlas readout and a Text
+    function benchmark_numericReadout() {
+        for (let i = 0; i < 20; i++)
+            benchReadout.value = (benchmarkPass * 20 + i) * 3.7 % 9000
+        benchmarkPass++
+        waitForRendering(benchReadout)
+    }
+
+    function benchmark_textReadout() {
+        for (let i = 0; i < 20; i++)
+            benchText.value = (benchmarkPass * 20 + i) * 3.7 % 9000
+        benchmarkPass++
+        waitForRendering(benchText)
+    }
+}
@@ -0,0 +1,201 @@
+import QtQuick
+import QtTest
+import DevDash.Gauges 1.0
+import DevDash.Gauges.Primitives 1.0
+import DevDash.Gauges.Compounds 1.0
+
+/**
+ * @brief Tests and benchmarks for the software-backend raster fast path
+ *
+ * Verifies that primitives draw from RasterCache when it is enabled, that
+ * identical ticks share one cached image and that moving the needle and
+ * value arc reuses their images instead of re-rasterizing, that
+ * DigitalReadout falls back to Text, which the software renderer can
+ * draw, instead of its glyph atlas material, and that MultiZoneArc and
+ * BarGauge draw on every backend. The benchmarks
+ * compare frame times of a four-gauge cluster with and without the cache.
+ *
+ * Registered a second time in CMake under QT_QUICK_BACKEND=software, where
+ * the cache is enabled by default.
+ */
+TestCase {
+    id: testCase
+    name: "SoftwareRasterTests"
+    when: windowShown
+
+    width: 800
+    height: 900
+
+    property int benchmarkPass: 0
+    property bool rasterDefault: false
+
+    Grid {
+        id: cluster
+        columns: 2
+
+        Repeater {
+            model: 4
+            RadialGauge {
+                width: 400
+                height: 400
+                showBezel: true
+                value: 20
+            }
+        }
+    }
+
+    DigitalReadout {
+        id: readout
+        y: 810
+        value: 42
+        normalColor: "#ff0000"
+    }
+
+    MultiZoneArc {
+        id: zones
+        x: 200
+        y: 810
+        width: 80
+        height: 80
+        strokeWidth: 16
+        bands: [{ from: 0, to: 100, color: "#ff0000" }]
+    }
+
+    BarGauge {
+        id: bar
+        x: 300
+        y: 830
+        width: 200
+        height: 24
+        segmentCount: 10
+        value: 100
+        normalColor: "#ff0000"
+    }
+
+    // The readout's value item, loaded into the first row of its Column
+    function readoutValueItem() {
+        return readout.children[0].children[0].item
+    }
+
+    // Red pixels prove an item reached the screen on this backend
+    function redPixels(item) {
+        waitForRendering(item)
+        const image = grabImage(item)
+        let red = 0
+        for (let x = 0; x < image.width; x += 2) {
+            for (let y = 0; y < image.height; y += 2) {
+                const pixel = image.pixel(x, y)
+                if (pixel.r > 0.6 && pixel.g < 0.3 && pixel.b < 0.3)
+                    red++
+            }
+        }
+        return red
+    }
+
+    function initTestCase() {
+        // Restored afterwards; the default follows the backend
+        rasterDefault = RasterCache.enabled
+    }
+
+    function cleanupTestCase() {
+        RasterCache.enabled = rasterDefault
+    }
+
+    function init() {
+        RasterCache.enabled = true
+        RasterCache.clear()
+        setValue(20)
+        waitForRendering(cluster)
+    }
+
+    function setValue(value) {
+        for (let i = 0; i < cluster.children.length; i++) {
+            if (cluster.children[i].value !== undefined)
+                cluster.children[i].value = value
+        }
+    }
+
+    function test_primitivesUseCache() {
+        RasterCache.clear()
+        setValue(30)
+        waitForRendering(cluster)
+        RasterCache.enabled = false
+        waitForRendering(cluster)
+        RasterCache.enabled = true
+        waitForRendering(cluster)
+        tryVerify(() => RasterCache.count > 0, 1000, "Primitives rasterized into the cache")
+        tryVerify(() => RasterCache.hits > RasterCache.misses, 1000,
+                  "Shared images hit (" + RasterCache.hits + " hits, " + RasterCache.misses + " misses)")
+    }
+
+    function test_ticksShareImages() {
+        // 4 gauges x (11 major + 40 minor) ticks collapse to a handful of images
+        tryVerify(() => RasterCache.count > 0, 1000)
+        verify(RasterCache.count < 40, "Cached images: " + RasterCache.count)
+    }
+
+    function test_valueChangesReuseImages() {
+        tryVerify(() => RasterCache.count > 0, 1000)
+        wait(500)  // let needle and arc animations settle
+        const misses = RasterCache.misses
+        const count = RasterCache.count
+
+        for (let v = 25; v <= 85; v += 10) {
+            setValue(v)
+            waitForRendering(cluster)
+        }
+        wait(500)
+        compare(RasterCache.misses, misses, "Needle rotation and arc sweep reuse the cached images")
+        compare(RasterCache.count, count, "Tick and needle images not evicted")
+    }
+
+    function test_disableRestoresShapes() {
+        RasterCache.enabled = false
+        waitForRendering(cluster)
+        const count = RasterCache.count
+        setValue(60)
+        waitForRendering(cluster)
+        wait(200)
+        compare(RasterCache.count, count, "Nothing rasterized while disabled")
+    }
+
+    function test_readoutFallsBackToText() {
+        const valueItem = readoutValueItem()
+        verify(valueItem, "Value item loaded")
+        compare(valueItem.text, "42", "Raster path draws the value as Text")
+
+        verify(redPixels(readout) > 0, "Readout value drawn")
+
+        // The atlas returns only where its material can be drawn
+        RasterCache.enabled = false
+        if (RasterCache.softwareBackend)
+            compare(readoutValueItem().text, "42", "Software backend keeps Text")
+        else
+            compare(readoutValueItem().text, undefined, "GPU backends use NumericReadout")
+    }
+
+    function test_zonesDrawn() {
+        verify(redPixels(zones) > 0, "Zone bands drawn")
+    }
+
+    function test_barDrawn() {
+        bar.value = 100
+        verify(redPixels(bar) > 0, "Bar segments drawn")
+
+        // Only the segments that go dark are rewritten
+        bar.value = 50
+        tryCompare(bar, "lastUpdatedSegments", 5, 1000)
+    }
+
+    function benchmark_frameRaster() {
+        RasterCache.enabled = true
+        setValue(20 + (benchmarkPass++ % 60))
+        waitForRendering(cluster)
+    }
+
+    function benchmark_frameShapes() {
+        RasterCache.enabled = false
+        setValue(20 + (benchmarkPass++ % 60))
+        waitForRendering(cluster)
+    }
+}
@@ -0,0 +1,155 @@
+import QtQuick
+import QtTest
+import DevDash.Gauges
+
+/**
+ * @brief Unit tests for ValueHistory, TrendTrace and the RadialGauge peak marker
+ *
+ * Verifies ring-buffer wrap-around, sliding min/max, peak hold and decay,
+ * min-max and LTTB decimation, and that TrendTrace appends samples to its
+ * geometry instead of rebuilding it.
+ */
+TestCase {
+    id: testCase
+    name: "ValueHistoryTests"
+    when: windowShown
+
+    width: 400
+    height: 400
+
+    ValueHistory {
+        id: history
+        capacity: 8
+        peakHoldTime: 100
+    }
+
+    ValueHistory {
+        id: traceHistory
+        capacity: 4096
+    }
+
+    TrendTrace {
+        id: trace
+        width: 200
+        height: 50
+        history: traceHistory
+        timeWindow: 2000
+    }
+
+    RadialGauge {
+        id: gauge
+        y: 60
+        width: 300
+        height: 300
+        showPeak: true
+        peakHoldTime: 100
+    }
+
+    function init() {
+        history.capacity = 8
+        history.peakHoldTime = 100
+        history.peakDecayRate = 0
+        history.clear()
+    }
+
+    function test_ringWrapsAround() {
+        for (let i = 1; i <= 12; i++)
+            history.append(i, i * 10)
+
+        compare(history.count, 8, "Capacity bounds the sample count")
+        const points = history.decimate(100, ValueHistory.Lttb)
+        compare(points.length, 8, "Fewer samples than buckets returns all")
+        compare(points[0].y, 5, "Oldest samples overwritten")
+        compare(points[7].y, 12)
+        compare(points[0].x, 50, "Timestamps kept")
+    }
+
+    function test_slidingMinMax() {
+        const values = [5, 1, 9, 3, 7, 2, 8, 4]
+        for (let i = 0; i < values.length; i++)
+            history.append(values[i], i)
+        compare(history.min, 1)
+        compare(history.max, 9)
+
+        // Push the 1 and the 9 out of the window
+        history.append(6, 8)
+        history.append(6, 9)
+        history.append(6, 10)
+        compare(history.min, 2, "Evicted minimum dropped")
+        compare(history.max, 8, "Evicted maximum dropped")
+    }
+
+    function test_peakHoldAndDrop() {
+        history.value = 80
+        compare(history.peak, 80)
+        history.value = 20
+        compare(history.peak, 80, "Peak held")
+        tryCompare(history, "peak", 20, 1000, "Peak drops after the hold time")
+    }
+
+    function test_peakDecay() {
+        history.peakDecayRate = 100  // units per second
+        history.value = 100
+        history.value = 0
+        wait(150)
+        verify(history.peak < 100 && history.peak > 0,
+               "Peak falling gradually (" + history.peak + ")")
+        tryCompare(history, "peak", 0, 2000, "Decays to the current value")
+    }
+
+    function test_minMaxDecimationKeepsSpikes() {
+        history.capacity = 4096
+        for (let i = 0; i < 1000; i++)
+            history.append(i === 503 ? 100 : 10, i)
+
+        const points = history.decimate(50)
+        verify(points.length <= 100, "At most two points per bucket")
+        let highest = 0
+        for (let i = 0; i < points.length; i++)
+            highest = Math.max(highest, points[i].y)
+        compare(highest, 100, "Single-sample spike survives decimation")
+    }
+
+    function test_lttbDecimation() {
+        history.capacity = 4096
+        for (let i = 0; i < 1000; i++)
+            history.append(Math.sin(i / 50) * 50, i)
+
+        const points = history.decimate(100, ValueHistory.Lttb)
+        compare(points.length, 100, "Exactly one point per bucket")
+        compare(points[0].x, 0, "First sample kept")
+        compare(points[99].x, 999, "Last sample kept")
+
+        const windowed = history.decimate(20, ValueHistory.Lttb, 100)
+        verify(windowed[0].x >= 899, "Time window limits the range")
+    }
+
+    function test_traceAppendsIncrementally() {
+        traceHistory.clear()
+        for (let i = 0; i < 50; i++) {
+            traceHistory.value = i % 2 ? 80 : 20
+            wait(5)
+        }
+        waitForRendering(trace)
+        wait(50)
+        const columns = trace.columnCount
+        verify(columns > 0, "Trace has geometry")
+
+        // A sample in a new pixel column adds at most one column plus a gap
+        traceHistory.value = 55
+        waitForRendering(trace)
+        tryVerify(() => trace.columnCount > columns && trace.columnCount <= columns + 2,
+                  1000, "Appended instead of rebuilt")
+    }
+
+    function test_radialGaugePeakMarker() {
+        gauge.value = 90
+        compare(gauge.peakValue, 90)
+        gauge.value = 30
+        compare(gauge.peakValue, 90, "Marker holds the peak")
+        tryCompare(gauge, "peakValue", 30, 1000, "Marker returns after the hold")
+
+        gauge.peakValue = 75
+        compare(gauge.peakValue, 75, "peakValue can be driven externally")
+    }
+}
@@ -15,6 +15,7 @@
 #include <cstdlib>
 #include <iostream>
 
+#include <QColor>
 #include <QGuiApplication>
 #include <QQmlApplicationEngine>
 #include <QQmlComponent>
@@ -449,6 +450,59 @@ TEST_CASE("RadialGauge template loads", "[qml][templates]") {
     delete obj;
 }
 
+/**
+ * @brief Test that compiled presets are embedded and exposed
+ */
+TEST_CASE("GaugePresets singleton loads compiled presets", "[qml][presets]") {
+    QQmlEngine engine;
+    setupEngine(engine);
+
+    auto* obj = createComponent(engine, R"(
+        import QtQuick
+        import DevDash.Gauges
+        QtObject {
+            property var components: GaugePresets.components
+            property var needlePresets: GaugePresets.presets("GaugeNeedle")
+        }
+    )", "GaugePresets");
+
+    REQUIRE(obj != nullptr);
+    REQUIRE(obj->property("components").toStringList().contains("GaugeNeedle"));
+    REQUIRE(obj->property("needlePresets").toStringList().contains("autometer"));
+    delete obj;
+}
+
+/**
+ * @brief Test that gauges pick up the global theme and attached overrides
+ */
+TEST_CASE("GaugeTheme colors RadialGauge", "[qml][theme]") {
+    QQmlEngine engine;
+    setupEngine(engine);
+
+    auto* obj = createComponent(engine, R"(
+        import QtQuick
+        import DevDash.Gauges
+        Item {
+            property color defaultFace: themed.faceColor
+            property color overriddenFace: overridden.faceColor
+            RadialGauge { id: themed }
+            Item {
+                GaugeTheme.theme: GaugeTheme { faceColor: "#000000"; transitionDuration: 0 }
+                RadialGauge { id: overridden }
+            }
+        }
+    )", "GaugeTheme");
+
+    REQUIRE(obj != nullptr);
+    REQUIRE(obj->property("defaultFace").value<QColor>() == QColor("#1a1a1a"));
+
+    // Overrides are applied by the next theme flush
+    QCoreApplication::processEvents();
+    REQUIRE(obj->property("overriddenFace").value<QColor>() == QColor("#000000"));
+    REQUIRE(obj->property("defaultFace").value<QColor>() == QColor("#1a1a1a"));
+    delete obj;
+}
+
 /**
  * @brief Test that multiple gauges can be composed
  */